@@ -0,0 +1,110 @@
+#include "attacks.h"
+#include "fill.h"
+
+#include <cstdint>
+#include <cassert>
+#include <iostream>
+
+template<StatusSource source, bool isWhite, bool ep>
+statusReport nodeStatus(Board &board, AttackTable &table) {
+    statusReport res;
+    if constexpr (source == ATTACKS) {
+        res = table.status<isWhite, ep>(board);
+    } else if constexpr (source == FILL) {
+        if constexpr (isWhite) res = checkFill<isWhite, ep>(board.w, board.b);
+        else res = checkFill<isWhite, ep>(board.b, board.w);
+        if (res.checkCount == 0) res.checkMask = ~res.checkMask;
+    } else {
+        return status<isWhite, ep>(board);
+    }
+    assert(sameStatus(res, status<isWhite, ep>(board))); // checked in debug builds
+    return res;
+}
+
+// the sink only depends on the source and f, so the piece kernels of generate are shared by every GameState
+template<StatusSource source, typename F>
+auto childSink(Board &board, AttackTable &table, F &f) {
+    return ChildSink {[&board, &table, &f](Board &child) {
+        if constexpr (source == ATTACKS) {
+            size_t mark = table.update(board, child);
+            f(child, table);
+            table.undo(mark);
+        } else {
+            f(child, table);
+        }
+    }};
+}
+
+// calls f(child, table) for every child of the given stage, with the table brought up to date for the child
+// and back for board around the call when the source is ATTACKS
+template<StatusSource source, GenType type, bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR, typename F>
+void walkChildren(Board &board, const statusReport &res, AttackTable &table, F &f) {
+    auto sink = childSink<source>(board, table, f);
+    generate<isWhite, ep, wL, wR, bL, bR, type>(board, res, sink);
+}
+
+template<StatusSource source>
+uint64_t attackPerft(int depth, Board &board, AttackTable &table) {
+    uint64_t nodes = 0;
+    auto descend = [&](Board &child, AttackTable &next) { nodes += attackPerft<source>(depth - 1, child, next); };
+    return withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() -> uint64_t {
+        statusReport res = nodeStatus<source, isWhite, ep>(board, table);
+        if (depth == 1) return countMoves<isWhite, ep, wL, wR, bL, bR>(board, res);
+
+        walkChildren<source, ALL, isWhite, ep, wL, wR, bL, bR>(board, res, table, descend);
+        return nodes;
+    });
+}
+
+template<StatusSource source>
+void attackCaptureTree(int plies, Board &board, AttackTable &table, QuiescenceCounts &counts) {
+    counts.nodes++;
+    if (plies == 0) return;
+    auto descend = [&](Board &child, AttackTable &next) { attackCaptureTree<source>(plies - 1, child, next, counts); };
+    withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        statusReport res = nodeStatus<source, isWhite, ep>(board, table);
+        walkChildren<source, CAPTURES, isWhite, ep, wL, wR, bL, bR>(board, res, table, descend);
+    });
+}
+
+template<StatusSource source>
+void attackQuiescenceTree(int depth, int plies, Board &board, AttackTable &table, QuiescenceCounts &counts) {
+    if (depth == 0) return attackCaptureTree<source>(plies, board, table, counts);
+    auto descend = [&](Board &child, AttackTable &next) { attackQuiescenceTree<source>(depth - 1, plies, child, next, counts); };
+    withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        statusReport res = nodeStatus<source, isWhite, ep>(board, table);
+        walkChildren<source, ALL, isWhite, ep, wL, wR, bL, bR>(board, res, table, descend);
+    });
+}
+
+namespace {
+
+// whether the undo stack of the table holds a walk plies deep
+bool tableFits(int plies) {
+    if (plies <= (int) AttackTable::MAX_PLIES) return true;
+    std::cerr << "Error: the AttackTable walk is limited to " << AttackTable::MAX_PLIES << " plies, " << plies << " requested" << std::endl;
+    return false;
+}
+
+} // namespace
+
+uint64_t attackPerft(int depth, Board &initial, StatusSource source) {
+    if (depth < 1) return 1;
+    if (source == ATTACKS && !tableFits(depth)) return 0;
+    AttackTable table;
+    table.init(initial);
+    if (source == ATTACKS) return attackPerft<ATTACKS>(depth, initial, table);
+    if (source == FILL) return attackPerft<FILL>(depth, initial, table);
+    return attackPerft<SCRATCH>(depth, initial, table);
+}
+
+QuiescenceCounts attackQuiescence(int depth, int plies, Board &initial, StatusSource source) {
+    QuiescenceCounts counts {0, 0, 0};
+    if (source == ATTACKS && !tableFits(depth + plies)) return counts;
+    AttackTable table;
+    table.init(initial);
+    if (source == ATTACKS) attackQuiescenceTree<ATTACKS>(depth, plies, initial, table, counts);
+    else if (source == FILL) attackQuiescenceTree<FILL>(depth, plies, initial, table, counts);
+    else attackQuiescenceTree<SCRATCH>(depth, plies, initial, table, counts);
+    return counts;
+}
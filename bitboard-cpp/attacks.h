@@ -0,0 +1,158 @@
+#pragma once
+
+#include "bitboard.h"
+#include "perft.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+
+// incrementally maintained slider attacks, an alternative source for the statusReport of check(). The table
+// holds the squares attacked by the slider on every square. After a move only the sliders on the changed
+// squares and the ones whose attacks ran through one of them are recomputed, and status() derives the
+// checks, pins and enemySeen from the stored sets instead of sliding every enemy piece again. Knight,
+// pawn and king attacks are table lookups and shifts already, so they are taken from the board as in check().
+// A walk keeps one table: update() saves the entries it overwrites, and undo() puts them back once the child
+// has been walked
+struct AttackTable {
+    Squares from[64]; // squares attacked by the slider on each square, 0 for other squares
+
+    // an entry update() overwrote; an update saves at most 64, one per square
+    struct Saved {
+        uint64_t index;
+        Squares attacks;
+    };
+    static constexpr size_t MAX_PLIES = 64;
+    Saved saved[64 * MAX_PLIES];
+    size_t top = 0;
+
+    static Squares pieceAttacks(const Board &board, uint64_t index, Squares occ) {
+        Squares square = positionToBit[index];
+        if ((board.w.r | board.b.r) & square) return slide(rookMoves[index], occ, index);
+        if ((board.w.b | board.b.b) & square) return slide(bishopMoves[index], occ, index);
+        if ((board.w.q | board.b.q) & square) return slide(rookMoves[index], occ, index) | slide(bishopMoves[index], occ, index);
+        return 0;
+    }
+
+    void init(const Board &board) {
+        Squares occ = board.w.occupied() | board.b.occupied();
+        for (uint64_t i = 0; i < 64; i++) from[i] = pieceAttacks(board, i, occ);
+        top = 0;
+    }
+
+    void set(uint64_t index, Squares attacks) {
+        if (attacks == from[index]) return;
+        saved[top++] = {index, from[index]};
+        from[index] = attacks;
+    }
+
+    // parent is the board this table is up to date for, child one of its children. Returns the mark to pass
+    // to undo() to get the table of parent back. At most MAX_PLIES updates may be outstanding
+    size_t update(const Board &parent, const Board &child) {
+        assert(top + 64 <= 64 * MAX_PLIES);
+        size_t mark = top;
+        Squares changed = (parent.w.occupied() ^ child.w.occupied()) | (parent.b.occupied() ^ child.b.occupied());
+        Squares occ = child.w.occupied() | child.b.occupied();
+
+        // a slider only sees a change of occupancy on a square it attacks, blockers included
+        Squares sliders = (child.w.r | child.w.b | child.w.q | child.b.r | child.b.b | child.b.q) & ~changed;
+        BitLoop(sliders) {
+            uint64_t index = _tzcnt_u64(temp);
+            if (from[index] & changed) set(index, pieceAttacks(child, index, occ));
+        }
+        BitLoop(changed) {
+            uint64_t index = _tzcnt_u64(temp);
+            set(index, pieceAttacks(child, index, occ));
+        }
+        return mark;
+    }
+
+    void undo(size_t mark) {
+        while (top > mark) {
+            top--;
+            from[saved[top].index] = saved[top].attacks;
+        }
+    }
+
+    // same report as status<isWhite, ep>(board)
+    template<bool isWhite, bool ep>
+    statusReport status(const Board &board) const {
+        Pieces self, enemy;
+        if constexpr (isWhite) {
+            self = board.w; enemy = board.b;
+        } else {
+            self = board.b; enemy = board.w;
+        }
+
+        Squares selfOcc = self.occupied();
+        Squares enemyOcc = enemy.occupied();
+        Squares occNotKing = (selfOcc | enemyOcc) & ~self.k;
+        uint64_t kingIndex = _tzcnt_u64(self.k);
+
+        uint64_t checkCount = 0;
+        Squares checkMask = 0, kingBan = 0, pinHV = 0, pinD = 0, epPin = 0, enemySeen = 0;
+
+        BitLoop(enemy.r | enemy.b | enemy.q) {
+            uint64_t pieceIndex = _tzcnt_u64(temp);
+            enemySeen |= from[pieceIndex];
+            if (from[pieceIndex] & self.k) {
+                checkMask |= pinRay(kingIndex, pieceIndex);
+                kingBan |= behindKing(kingIndex, pieceIndex);
+                checkCount++;
+            }
+        }
+        BitLoop(enemy.n) {
+            Squares atk = knightMoves[_tzcnt_u64(temp)];
+            enemySeen |= atk;
+            if (atk & self.k) {
+                checkMask |= _blsi_u64(temp);
+                checkCount++;
+            }
+        }
+        Squares atkL, atkR;
+        if constexpr (isWhite) {
+            atkL = (enemy.p & notAfile) >> 9;
+            atkR = (enemy.p & notHfile) >> 7;
+            if (atkL & self.k) {checkMask |= (self.k << 9) & enemy.p; checkCount++;}
+            if (atkR & self.k) {checkMask |= (self.k << 7) & enemy.p; checkCount++;}
+        } else {
+            atkL = (enemy.p & notAfile) << 7;
+            atkR = (enemy.p & notHfile) << 9;
+            if (atkL & self.k) {checkMask |= (self.k >> 7) & enemy.p; checkCount++;}
+            if (atkR & self.k) {checkMask |= (self.k >> 9) & enemy.p; checkCount++;}
+        }
+        enemySeen |= atkL | atkR;
+        enemySeen |= kingMoves[_tzcnt_u64(enemy.k)];
+
+        // pins, from the sliders lined up with the king that do not give check
+        BitLoop((enemy.r | enemy.q) & rookMoves[kingIndex]) {
+            uint64_t pieceIndex = _tzcnt_u64(temp);
+            if (from[pieceIndex] & self.k) continue;
+            Squares pin = pinRay(kingIndex, pieceIndex);
+            Squares inbetween = (pin ^ _blsi_u64(temp)) & occNotKing;
+            Squares onePieceRemoved = _blsr_u64(inbetween);
+            if (!onePieceRemoved) pinHV |= pin;
+            else if (!_blsr_u64(onePieceRemoved) && ep && (pieceIndex/8 == kingIndex/8)) epPin |= inbetween & self.p;
+        }
+        BitLoop((enemy.b | enemy.q) & bishopMoves[kingIndex]) {
+            uint64_t pieceIndex = _tzcnt_u64(temp);
+            if (from[pieceIndex] & self.k) continue;
+            Squares pin = pinRay(kingIndex, pieceIndex);
+            if (!_blsr_u64((pin ^ _blsi_u64(temp)) & occNotKing)) pinD |= pin;
+        }
+
+        if (checkCount == 0) checkMask = ~checkMask;
+        return {checkCount, kingIndex, checkMask, kingBan, pinHV, pinD, enemySeen, selfOcc, enemyOcc, epPin};
+    }
+};
+
+// where the walks below take the statusReport of every node from: check(), an AttackTable carried along,
+// or the set-wise fills of checkFill() in fill.h
+enum StatusSource { SCRATCH, ATTACKS, FILL };
+
+// perft and the quiescence workload of quiescence() on a runtime dispatched walk. The walks are the same
+// code for every source apart from the statusReport, so their times compare the sources. The undo stack of
+// the table bounds the ATTACKS walks to depth + plies <= AttackTable::MAX_PLIES; deeper ones are refused
+// on stderr and count nothing
+uint64_t attackPerft(int depth, Board &initial, StatusSource source);
+QuiescenceCounts attackQuiescence(int depth, int plies, Board &initial, StatusSource source);
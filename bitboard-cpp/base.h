@@ -0,0 +1,548 @@
+#pragma once
+
+#include "zobrist.h"
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+#define KING 0
+#define QUEEN 1
+#define ROOK 2
+#define BISHOP 3
+#define KNIGHT 4
+#define PAWN 5
+
+typedef uint64_t Squares;
+
+constexpr Squares notAfile = 0xfefefefefefefefeULL;
+constexpr Squares notHfile = 0x7f7f7f7f7f7f7f7fULL;
+
+constexpr Squares wPawnStart = 0x000000000000ff00ULL;
+constexpr Squares bPawnStart = 0x00ff000000000000ULL;
+constexpr Squares PawnMiddle = 0x0000ffffffff0000ULL;
+constexpr Squares wPawnLast = bPawnStart;
+constexpr Squares bPawnLast = wPawnStart;
+constexpr Squares wPawnEP = 0x000000ff00000000ULL;
+constexpr Squares bPawnEP = 0x00000000ff000000ULL;
+
+constexpr Squares wLrookStart = 0x0000000000000001ULL;
+constexpr Squares wRrookStart = 0x0000000000000080ULL;
+constexpr Squares bLrookStart = 0x0100000000000000ULL;
+constexpr Squares bRrookStart = 0x8000000000000000ULL;
+
+constexpr Squares wLCastleEmpty = 0x000000000000000eULL; // squares between king and rook
+constexpr Squares wRCastleEmpty = 0x0000000000000060ULL;
+constexpr Squares bLCastleEmpty = 0x0e00000000000000ULL;
+constexpr Squares bRCastleEmpty = 0x6000000000000000ULL;
+
+constexpr Squares wLCastleSeen = 0x000000000000000cULL; // squares the king crosses, b1/b8 may be attacked
+constexpr Squares wRCastleSeen = 0x0000000000000060ULL;
+constexpr Squares bLCastleSeen = 0x0c00000000000000ULL;
+constexpr Squares bRCastleSeen = 0x6000000000000000ULL;
+
+struct GameState {
+    bool ep;
+    bool wL;
+    bool wR;
+    bool bL;
+    bool bR;
+    bool isWhite;
+
+    GameState() = default; // left uninitialised so move buffers cost nothing to declare
+
+    constexpr GameState(bool ep_, bool wL_, bool wR_, bool bL_, bool bR_, bool isWhite_)
+        : ep(ep_), wL(wL_), wR(wR_), bL(bL_), bR(bR_), isWhite(isWhite_) {}
+
+    bool hasCastle() {
+        if (isWhite) return wL || wR;
+        else return bL || bR; 
+    }
+
+    bool enemyCastle() {
+        if (isWhite) return bL || bR;
+        else return wL || wR; 
+    }
+
+    uint8_t stateToInt(void) {
+        return isWhite | ep << 1 | wL << 2 | wR << 3 | bL << 4 | bR << 5;
+    }
+
+    uint8_t castleToInt(void) const {
+        return wL | wR << 1 | bL << 2 | bR << 3;
+    }
+
+    template<bool White>
+    GameState kingMove() {
+        if constexpr (White) return {false, false, false, bL, bR, false};
+        else return {false, wL, wR, false, false, true};
+    }
+
+    template<bool White>
+    GameState move() {
+        if constexpr (White) return {false, wL, wR, bL, bR, false};
+        else return {false, wL, wR, bL, bR, true};
+    }
+
+    template<bool White>
+    GameState LRookMove() {
+        if constexpr (White) return {false, false, wR, bL, bR, false};
+        else return {false, wL, wR, false, bR, true};
+    }
+
+    template<bool White>
+    GameState RRookMove() {
+        if constexpr (White) return {false, wL, false, bL, bR, false};
+        else return {false, wL, wR, bL, false, true};
+    }
+
+    template<bool White>
+    GameState pawnPush() {
+        if constexpr (White) return {true, wL, wR, bL, bR, false};
+        else return {true, wL, wR, bL, bR, true};
+    }
+};
+
+struct Pieces {
+    Squares k; Squares q; Squares r; Squares b; Squares n; Squares p;
+
+    Pieces moveKing(Squares move) { return {k ^ move, q, r, b, n, p}; } // move contains the initial and final bits of the piece
+    Pieces moveQueen(Squares move) { return {k, q ^ move, r, b, n, p}; } 
+    Pieces moveRook(Squares move) { return {k, q, r ^ move, b, n, p}; } 
+    Pieces moveBishop(Squares move) { return {k, q, r, b ^ move, n, p}; } 
+    Pieces moveKnight(Squares move) { return {k, q, r, b, n ^ move, p}; } 
+    Pieces movePawn(Squares move) { return {k, q, r, b, n, p ^ move}; }
+
+    Pieces remove(Squares pos) { return {k, q & pos, r & pos, b & pos, n & pos, p & pos}; } // pos contains ones except on the removed piece
+
+    Squares occupied() const { return k|q|r|b|n|p; }
+};
+
+// packed move: bits 0-5 from square, 6-11 to square, 12-14 moving piece, 15-17 promotion piece
+// (0 when not a promotion, KING can never be promoted to), 18-21 flags
+struct Move {
+    uint32_t data;
+
+    static constexpr uint32_t CAPTURE = 1 << 18;
+    static constexpr uint32_t EP = 1 << 19; // e.p. capture, the captured pawn is the board's ep square
+    static constexpr uint32_t CASTLE = 1 << 20; // from/to are the king squares
+    static constexpr uint32_t PUSH = 1 << 21; // pawn double push
+
+    Move() = default;
+    constexpr Move(uint64_t from, uint64_t to, int piece, uint32_t flags, int promotion = 0)
+        : data((uint32_t) from | (uint32_t) to << 6 | piece << 12 | promotion << 15 | flags) {}
+
+    int from() const { return data & 63; }
+    int to() const { return (data >> 6) & 63; }
+    int piece() const { return (data >> 12) & 7; }
+    int promotion() const { return (data >> 15) & 7; }
+    bool isCapture() const { return data & CAPTURE; }
+    bool isEP() const { return data & EP; }
+    bool isCastle() const { return data & CASTLE; }
+    bool isPush() const { return data & PUSH; }
+
+    bool operator==(const Move &other) const { return data == other.data; }
+};
+
+// mailbox codes, 0 for an empty square
+template<int piece, bool isWhite>
+constexpr uint8_t mailboxCode = piece + 1 + (isWhite ? 0 : 8);
+
+struct Board {
+    Pieces w; Pieces b; uint64_t ep; GameState state; uint64_t hash; // hash is kept up to date by every transition
+#if defined(BOARD_MAILBOX)
+    uint8_t mailbox[64]; // mailboxCode of the piece on every square, kept up to date by every transition
+#endif
+
+    // mailboxCode of the piece on square, from the mailbox when there is one
+    uint8_t pieceOn(uint64_t square) const {
+#if defined(BOARD_MAILBOX)
+        return mailbox[square];
+#else
+        Squares bit = 1ULL << square;
+        const Squares pieces[2][6] {{b.k, b.q, b.r, b.b, b.n, b.p}, {w.k, w.q, w.r, w.b, w.n, w.p}};
+        for (int color = 0; color < 2; color++) {
+            for (int piece = 0; piece < 6; piece++) {
+                if (pieces[color][piece] & bit) return piece + 1 + (color ? 0 : 8);
+            }
+        }
+        return 0;
+#endif
+    }
+
+    // mailbox upkeep, no-ops in builds without BOARD_MAILBOX. A child starts from a copy of the parent's
+    // mailbox and its transition rewrites the squares it touched
+    void fillMailbox() { // from the bitboards, to set up parsed positions
+#if defined(BOARD_MAILBOX)
+        std::memset(mailbox, 0, 64);
+        const Squares pieces[2][6] {{b.k, b.q, b.r, b.b, b.n, b.p}, {w.k, w.q, w.r, w.b, w.n, w.p}};
+        for (int color = 0; color < 2; color++) {
+            for (int piece = 0; piece < 6; piece++) {
+                for (Squares temp = pieces[color][piece]; temp; temp = _blsr_u64(temp)) mailbox[_tzcnt_u64(temp)] = piece + 1 + (color ? 0 : 8);
+            }
+        }
+#endif
+    }
+
+    bool mailboxInSync() const { // to verify the incremental updates
+#if defined(BOARD_MAILBOX)
+        Board scratch = *this;
+        scratch.fillMailbox();
+        return !std::memcmp(mailbox, scratch.mailbox, 64);
+#else
+        return true;
+#endif
+    }
+
+    void inheritMailbox([[maybe_unused]] const Board &parent) {
+#if defined(BOARD_MAILBOX)
+        std::memcpy(mailbox, parent.mailbox, 64);
+#endif
+    }
+
+    // the piece of code moves between the two squares of move, capturing whatever stood on the other one
+    void moveOnMailbox([[maybe_unused]] Squares move, [[maybe_unused]] uint8_t code) {
+#if defined(BOARD_MAILBOX)
+        uint64_t first = _tzcnt_u64(move), second = 63 - _lzcnt_u64(move);
+        uint64_t leaving = mailbox[first] == code ? first : second;
+        mailbox[first ^ second ^ leaving] = code;
+        mailbox[leaving] = 0;
+#endif
+    }
+
+    void setOnMailbox([[maybe_unused]] Squares square, [[maybe_unused]] uint8_t code) {
+#if defined(BOARD_MAILBOX)
+        mailbox[_tzcnt_u64(square)] = code;
+#endif
+    }
+
+    // from scratch, to set up parsed positions and to verify the incremental updates
+    uint64_t computeHash() const {
+        const Squares pieces[2][6] {{b.k, b.q, b.r, b.b, b.n, b.p}, {w.k, w.q, w.r, w.b, w.n, w.p}};
+        uint64_t key = 0;
+        for (int color = 0; color < 2; color++) {
+            for (int piece = 0; piece < 6; piece++) {
+                for (Squares temp = pieces[color][piece]; temp; temp = _blsr_u64(temp)) key ^= zobrist.piece[color][piece][_tzcnt_u64(temp)];
+            }
+        }
+        if (state.isWhite) key ^= zobrist.side;
+        return key ^ zobrist.castle[state.castleToInt()] ^ zobrist.ep[_tzcnt_u64(ep)];
+    }
+
+    // next carries the child's pieces and state with a 0 hash, set here from pieceKeys, the piece-square keys that changed
+    Board child(Board next, uint64_t pieceKeys) const {
+        next.hash = hash ^ pieceKeys ^ zobrist.side ^ zobrist.castle[state.castleToInt()] ^ zobrist.castle[next.state.castleToInt()]
+            ^ zobrist.ep[_tzcnt_u64(ep)] ^ zobrist.ep[_tzcnt_u64(next.ep)];
+        return next;
+    }
+
+    template<int piece, bool isWhite>
+    static uint64_t moveKey(Squares move) { // move contains the initial and final bits of the piece
+        return zobrist.piece[isWhite][piece][_tzcnt_u64(move)] ^ zobrist.piece[isWhite][piece][_tzcnt_u64(_blsr_u64(move))];
+    }
+
+    template<int piece, bool isWhite>
+    static uint64_t promoteKey(Squares pawnSquare, Squares square) {
+        return zobrist.piece[isWhite][PAWN][_tzcnt_u64(pawnSquare)] ^ zobrist.piece[isWhite][piece][_tzcnt_u64(square)];
+    }
+
+    template<bool isWhite>
+    uint64_t captureKey(Squares move) const { // key of the enemy piece on one of the bits of move
+        const uint64_t (&keys)[6][64] = zobrist.piece[!isWhite];
+#if defined(BOARD_MAILBOX)
+        uint64_t first = _tzcnt_u64(move), second = 63 - _lzcnt_u64(move);
+        uint64_t index = (mailbox[first] & 8) == (isWhite ? 8 : 0) ? first : second;
+        return keys[(mailbox[index] & 7) - 1][index];
+#else
+        const Pieces &enemy = isWhite ? b : w;
+        uint64_t index = _tzcnt_u64(move & enemy.occupied());
+
+        uint64_t key = 0;
+        if (enemy.q & move) key = keys[QUEEN][index];
+        if (enemy.r & move) key = keys[ROOK][index];
+        if (enemy.b & move) key = keys[BISHOP][index];
+        if (enemy.n & move) key = keys[KNIGHT][index];
+        if (enemy.p & move) key = keys[PAWN][index];
+        return key;
+#endif
+    }
+
+    // capturing a rook on its corner takes the enemy's castling right with it
+    template<bool isWhite>
+    Board captureChild(Board next, uint64_t pieceKeys, Squares move) const {
+        if constexpr (isWhite) {
+            next.state.bL = next.state.bL && !(move & bLrookStart);
+            next.state.bR = next.state.bR && !(move & bRrookStart);
+        } else {
+            next.state.wL = next.state.wL && !(move & wLrookStart);
+            next.state.wR = next.state.wR && !(move & wRrookStart);
+        }
+        return child(next, pieceKeys);
+    }
+
+    template<int piece, bool isWhite>
+    Board pieceMoveBitboards(Squares move) { // piece moves without captures
+        if constexpr (isWhite) {
+            if constexpr (piece == KING) return child({w.moveKing(move), b, 0, state.kingMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == QUEEN) return child({w.moveQueen(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == BISHOP) return child({w.moveBishop(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == KNIGHT) return child({w.moveKnight(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == PAWN) return child({w.movePawn(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+
+            if constexpr (piece == ROOK) {
+                if (!state.hasCastle()) return child({w.moveRook(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                else { // check if move and initial rook positions coincide to remove castling possibility
+                    if (move & wLrookStart) return child({w.moveRook(move), b, 0, state.LRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                    if (move & wRrookStart) return child({w.moveRook(move), b, 0, state.RRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                    return child({w.moveRook(move), b, 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move)); // rook that already left its corner
+                }
+            }
+        } else {
+            if constexpr (piece == KING) return child({w, b.moveKing(move), 0, state.kingMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == QUEEN) return child({w, b.moveQueen(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == BISHOP) return child({w, b.moveBishop(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == KNIGHT) return child({w, b.moveKnight(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+            if constexpr (piece == PAWN) return child({w, b.movePawn(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+
+            if constexpr (piece == ROOK) {
+                if (!state.hasCastle()) return child({w, b.moveRook(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                else {
+                    if (move & bLrookStart) return child({w, b.moveRook(move), 0, state.LRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                    if (move & bRrookStart) return child({w, b.moveRook(move), 0, state.RRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move));
+                    return child({w, b.moveRook(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move)); // rook that already left its corner
+                }
+            }
+        }
+    }
+
+    template<bool isWhite>
+    Board pawnPushBitboards(Squares pawnSquare, Squares move) {
+        if constexpr (isWhite) return child({w.movePawn(move), b, pawnSquare, state.pawnPush<isWhite>(), 0}, moveKey<PAWN, isWhite>(move));
+        else return child({w, b.movePawn(move), pawnSquare, state.pawnPush<isWhite>(), 0}, moveKey<PAWN, isWhite>(move));
+    }
+
+    template<bool isWhite>
+    Board pawnEPBitboards(Squares pawnSquare, Squares move) {
+        if constexpr (isWhite) return child({w.movePawn(move), b.remove(~pawnSquare), 0, state.move<isWhite>(), 0}, moveKey<PAWN, isWhite>(move) ^ zobrist.piece[!isWhite][PAWN][_tzcnt_u64(pawnSquare)]);
+        else return child({w.remove(~pawnSquare), b.movePawn(move), 0, state.move<isWhite>(), 0}, moveKey<PAWN, isWhite>(move) ^ zobrist.piece[!isWhite][PAWN][_tzcnt_u64(pawnSquare)]);
+    }
+
+    template<int piece, bool isWhite>
+    Board pawnPromoteBitboards(Squares pawnSquare, Squares move) {
+        if constexpr (isWhite) {
+            Pieces wn = w.movePawn(pawnSquare);
+            if constexpr (piece == QUEEN) return child({wn.moveQueen(move), b, 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == BISHOP) return child({wn.moveBishop(move), b, 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == KNIGHT) return child({wn.moveKnight(move), b, 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == ROOK) return child({wn.moveRook(move), b, 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+        } else {
+            Pieces bn = b.movePawn(pawnSquare);
+            if constexpr (piece == QUEEN) return child({w, bn.moveQueen(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == BISHOP) return child({w, bn.moveBishop(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == KNIGHT) return child({w, bn.moveKnight(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+            if constexpr (piece == ROOK) return child({w, bn.moveRook(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move));
+        }
+    }
+
+    template<int piece, bool isWhite>
+    Board pawnPromoteCaptureBitboards(Squares pawnSquare, Squares move) {
+        Squares notmove = ~move;
+        if constexpr (isWhite) {
+            Pieces wn = w.movePawn(pawnSquare);
+            if constexpr (piece == QUEEN) return captureChild<isWhite>({wn.moveQueen(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == BISHOP) return captureChild<isWhite>({wn.moveBishop(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == KNIGHT) return captureChild<isWhite>({wn.moveKnight(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == ROOK) return captureChild<isWhite>({wn.moveRook(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+        } else {
+            Pieces bn = b.movePawn(pawnSquare);
+            if constexpr (piece == QUEEN) return captureChild<isWhite>({w.remove(notmove), bn.moveQueen(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == BISHOP) return captureChild<isWhite>({w.remove(notmove), bn.moveBishop(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == KNIGHT) return captureChild<isWhite>({w.remove(notmove), bn.moveKnight(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == ROOK) return captureChild<isWhite>({w.remove(notmove), bn.moveRook(move), 0, state.move<isWhite>(), 0}, promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move), move);
+        }
+    }
+
+    template<int piece, bool isWhite>
+    Board pieceMoveCaptureBitboards(Squares move) { // piece moves with captures
+        Squares notmove = ~move;
+        if constexpr (isWhite) {
+            if constexpr (piece == KING) return captureChild<isWhite>({w.moveKing(move), b.remove(notmove), 0, state.kingMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == QUEEN) return captureChild<isWhite>({w.moveQueen(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == BISHOP) return captureChild<isWhite>({w.moveBishop(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == KNIGHT) return captureChild<isWhite>({w.moveKnight(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == PAWN) return captureChild<isWhite>({w.movePawn(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+
+            if constexpr (piece == ROOK) {
+                if (!state.hasCastle()) return captureChild<isWhite>({w.moveRook(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                else {
+                    if (move & wLrookStart) return captureChild<isWhite>({w.moveRook(move), b.remove(notmove), 0, state.LRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                    if (move & wRrookStart) return captureChild<isWhite>({w.moveRook(move), b.remove(notmove), 0, state.RRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                    return captureChild<isWhite>({w.moveRook(move), b.remove(notmove), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move); // rook that already left its corner
+                }
+            }
+        } else {
+            if constexpr (piece == KING) return captureChild<isWhite>({w.remove(notmove), b.moveKing(move), 0, state.kingMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == QUEEN) return captureChild<isWhite>({w.remove(notmove), b.moveQueen(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == BISHOP) return captureChild<isWhite>({w.remove(notmove), b.moveBishop(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == KNIGHT) return captureChild<isWhite>({w.remove(notmove), b.moveKnight(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+            if constexpr (piece == PAWN) return captureChild<isWhite>({w.remove(notmove), b.movePawn(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+
+            if constexpr (piece == ROOK) {
+                if (!state.hasCastle()) return captureChild<isWhite>({w.remove(notmove), b.moveRook(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                else {
+                    if (move & bLrookStart) return captureChild<isWhite>({w.remove(notmove), b.moveRook(move), 0, state.LRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                    if (move & bRrookStart) return captureChild<isWhite>({w.remove(notmove), b.moveRook(move), 0, state.RRookMove<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move);
+                    return captureChild<isWhite>({w.remove(notmove), b.moveRook(move), 0, state.move<isWhite>(), 0}, moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(move), move); // rook that already left its corner
+                }
+            }
+        }
+    }
+
+    template<bool isWhite>
+    Board castleLBitboards() {
+        if constexpr (isWhite) {
+            Pieces wn = w.moveKing(0x0000000000000014ULL);
+            return child({wn.moveRook(0x0000000000000009ULL), b, 0, state.kingMove<isWhite>(), 0}, moveKey<KING, isWhite>(0x0000000000000014ULL) ^ moveKey<ROOK, isWhite>(0x0000000000000009ULL));
+        } else {
+            Pieces bn = b.moveKing(0x1400000000000000ULL);
+            return child({w, bn.moveRook(0x0900000000000000ULL), 0, state.kingMove<isWhite>(), 0}, moveKey<KING, isWhite>(0x1400000000000000ULL) ^ moveKey<ROOK, isWhite>(0x0900000000000000ULL));
+        }
+    }
+
+    template<bool isWhite>
+    Board castleRBitboards() {
+        if constexpr (isWhite) {
+            Pieces wn = w.moveKing(0x0000000000000050ULL);
+            return child({wn.moveRook(0x00000000000000a0ULL), b, 0, state.kingMove<isWhite>(), 0}, moveKey<KING, isWhite>(0x0000000000000050ULL) ^ moveKey<ROOK, isWhite>(0x00000000000000a0ULL));
+        } else {
+            Pieces bn = b.moveKing(0x5000000000000000ULL);
+            return child({w, bn.moveRook(0xa000000000000000ULL), 0, state.kingMove<isWhite>(), 0}, moveKey<KING, isWhite>(0x5000000000000000ULL) ^ moveKey<ROOK, isWhite>(0xa000000000000000ULL));
+        }
+    }
+
+    // the transitions: the bitboard ones above, then the mailbox brought in step
+    template<int piece, bool isWhite>
+    Board pieceMove(Squares move) {
+        Board next = pieceMoveBitboards<piece, isWhite>(move);
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(move, mailboxCode<piece, isWhite>);
+        return next;
+    }
+
+    template<int piece, bool isWhite>
+    Board pieceMoveCapture(Squares move) {
+        Board next = pieceMoveCaptureBitboards<piece, isWhite>(move);
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(move, mailboxCode<piece, isWhite>);
+        return next;
+    }
+
+    template<bool isWhite>
+    Board pawnPush(Squares pawnSquare, Squares move) {
+        Board next = pawnPushBitboards<isWhite>(pawnSquare, move);
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(move, mailboxCode<PAWN, isWhite>);
+        return next;
+    }
+
+    template<bool isWhite>
+    Board pawnEP(Squares pawnSquare, Squares move) {
+        Board next = pawnEPBitboards<isWhite>(pawnSquare, move);
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(move, mailboxCode<PAWN, isWhite>);
+        next.setOnMailbox(pawnSquare, 0);
+        return next;
+    }
+
+    template<int piece, bool isWhite>
+    Board pawnPromote(Squares pawnSquare, Squares move) {
+        Board next = pawnPromoteBitboards<piece, isWhite>(pawnSquare, move);
+        next.inheritMailbox(*this);
+        next.setOnMailbox(pawnSquare, 0);
+        next.setOnMailbox(move, mailboxCode<piece, isWhite>);
+        return next;
+    }
+
+    template<int piece, bool isWhite>
+    Board pawnPromoteCapture(Squares pawnSquare, Squares move) {
+        Board next = pawnPromoteCaptureBitboards<piece, isWhite>(pawnSquare, move);
+        next.inheritMailbox(*this);
+        next.setOnMailbox(pawnSquare, 0);
+        next.setOnMailbox(move, mailboxCode<piece, isWhite>);
+        return next;
+    }
+
+    template<bool isWhite>
+    Board castleL() {
+        Board next = castleLBitboards<isWhite>();
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(isWhite ? 0x0000000000000014ULL : 0x1400000000000000ULL, mailboxCode<KING, isWhite>);
+        next.moveOnMailbox(isWhite ? 0x0000000000000009ULL : 0x0900000000000000ULL, mailboxCode<ROOK, isWhite>);
+        return next;
+    }
+
+    template<bool isWhite>
+    Board castleR() {
+        Board next = castleRBitboards<isWhite>();
+        next.inheritMailbox(*this);
+        next.moveOnMailbox(isWhite ? 0x0000000000000050ULL : 0x5000000000000000ULL, mailboxCode<KING, isWhite>);
+        next.moveOnMailbox(isWhite ? 0x00000000000000a0ULL : 0xa000000000000000ULL, mailboxCode<ROOK, isWhite>);
+        return next;
+    }
+
+    // copy-make: plays m through the matching transition above and returns the child, so there is no unmake
+    template<bool isWhite>
+    Board makeMove(Move m) {
+        Squares from = 1ULL << m.from();
+        Squares to = 1ULL << m.to();
+
+        if (m.isCastle()) {
+            if (to < from) return castleL<isWhite>();
+            return castleR<isWhite>();
+        }
+        if (m.isEP()) return pawnEP<isWhite>(ep, from | to);
+        if (m.isPush()) return pawnPush<isWhite>(to, from | to);
+
+        if (m.promotion()) {
+            if (m.isCapture()) {
+                switch (m.promotion()) {
+                    case QUEEN: return pawnPromoteCapture<QUEEN, isWhite>(from, to);
+                    case ROOK: return pawnPromoteCapture<ROOK, isWhite>(from, to);
+                    case BISHOP: return pawnPromoteCapture<BISHOP, isWhite>(from, to);
+                    default: return pawnPromoteCapture<KNIGHT, isWhite>(from, to);
+                }
+            }
+            switch (m.promotion()) {
+                case QUEEN: return pawnPromote<QUEEN, isWhite>(from, to);
+                case ROOK: return pawnPromote<ROOK, isWhite>(from, to);
+                case BISHOP: return pawnPromote<BISHOP, isWhite>(from, to);
+                default: return pawnPromote<KNIGHT, isWhite>(from, to);
+            }
+        }
+
+        if (m.isCapture()) {
+            switch (m.piece()) {
+                case KING: return pieceMoveCapture<KING, isWhite>(from | to);
+                case QUEEN: return pieceMoveCapture<QUEEN, isWhite>(from | to);
+                case ROOK: return pieceMoveCapture<ROOK, isWhite>(from | to);
+                case BISHOP: return pieceMoveCapture<BISHOP, isWhite>(from | to);
+                case KNIGHT: return pieceMoveCapture<KNIGHT, isWhite>(from | to);
+                default: return pieceMoveCapture<PAWN, isWhite>(from | to);
+            }
+        }
+        switch (m.piece()) {
+            case KING: return pieceMove<KING, isWhite>(from | to);
+            case QUEEN: return pieceMove<QUEEN, isWhite>(from | to);
+            case ROOK: return pieceMove<ROOK, isWhite>(from | to);
+            case BISHOP: return pieceMove<BISHOP, isWhite>(from | to);
+            case KNIGHT: return pieceMove<KNIGHT, isWhite>(from | to);
+            default: return pieceMove<PAWN, isWhite>(from | to);
+        }
+    }
+
+    Board makeMove(Move m) {
+        if (state.isWhite) return makeMove<true>(m);
+        return makeMove<false>(m);
+    }
+};
@@ -0,0 +1,351 @@
+#include "batch.h"
+#include "fill.h"
+
+#include <cstdint>
+#include <utility>
+#include <immintrin.h>
+
+// the lanes of the kernel are positions, not directions as in fill.h. Backends, selected at compile time:
+//   BATCH_AVX512 - 8 positions per vector (default when compiled with AVX-512F)
+//   BATCH_AVX2   - 4 positions per vector
+//   BATCH_SCALAR - one position at a time, the same kernel on plain integers
+#if !defined(BATCH_AVX512) && !defined(BATCH_AVX2) && !defined(BATCH_SCALAR)
+#if defined(__AVX512F__)
+#define BATCH_AVX512
+#elif defined(__AVX2__)
+#define BATCH_AVX2
+#else
+#define BATCH_SCALAR
+#endif
+#endif
+
+#if defined(BATCH_AVX512)
+const char *batchBackend = "avx512";
+#elif defined(BATCH_AVX2)
+const char *batchBackend = "avx2";
+#else
+const char *batchBackend = "scalar";
+#endif
+
+#if defined(BATCH_AVX512) && defined(__GNUC__) && !defined(__clang__)
+// the GCC 12 false positive described in fill.h, here on the shifts and rotates of the kernel
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// a bitboard per lane; masks are all ones or all zeros in every lane
+namespace {
+
+#if defined(BATCH_AVX512)
+struct Lanes {
+    __m512i v;
+    static constexpr size_t width = 8;
+
+    static Lanes load(const Squares *p) { return {_mm512_loadu_si512(p)}; }
+    void store(Squares *p) const { _mm512_storeu_si512(p, v); }
+    static Lanes all(Squares x) { return {_mm512_set1_epi64(x)}; }
+
+    Lanes operator&(Lanes o) const { return {_mm512_and_si512(v, o.v)}; }
+    Lanes operator|(Lanes o) const { return {_mm512_or_si512(v, o.v)}; }
+    Lanes operator+(Lanes o) const { return {_mm512_add_epi64(v, o.v)}; }
+    Lanes operator-(Lanes o) const { return {_mm512_sub_epi64(v, o.v)}; }
+    Lanes operator~() const { return {_mm512_ternarylogic_epi64(v, v, v, 0x55)}; }
+
+    template<int n> Lanes shift() const { // left for n > 0, right otherwise
+        if constexpr (n > 0) return {_mm512_slli_epi64(v, n)};
+        else return {_mm512_srli_epi64(v, -n)};
+    }
+    Lanes nonzero() const { return {_mm512_maskz_set1_epi64(_mm512_test_epi64_mask(v, v), -1)}; }
+    bool any() const { return _mm512_test_epi64_mask(v, v); }
+    Lanes popcount() const {
+#if defined(__AVX512VPOPCNTDQ__)
+        return {_mm512_popcnt_epi64(v)};
+#else
+        alignas(64) uint64_t x[8];
+        _mm512_store_si512(x, v);
+        for (auto &i : x) i = _popcnt64(i);
+        return {_mm512_load_si512(x)};
+#endif
+    }
+};
+#elif defined(BATCH_AVX2)
+struct Lanes {
+    __m256i v;
+    static constexpr size_t width = 4;
+
+    static Lanes load(const Squares *p) { return {_mm256_loadu_si256((const __m256i *) p)}; }
+    void store(Squares *p) const { _mm256_storeu_si256((__m256i *) p, v); }
+    static Lanes all(Squares x) { return {_mm256_set1_epi64x(x)}; }
+
+    Lanes operator&(Lanes o) const { return {_mm256_and_si256(v, o.v)}; }
+    Lanes operator|(Lanes o) const { return {_mm256_or_si256(v, o.v)}; }
+    Lanes operator+(Lanes o) const { return {_mm256_add_epi64(v, o.v)}; }
+    Lanes operator-(Lanes o) const { return {_mm256_sub_epi64(v, o.v)}; }
+    Lanes operator~() const { return {_mm256_xor_si256(v, _mm256_set1_epi64x(-1))}; }
+
+    template<int n> Lanes shift() const {
+        if constexpr (n > 0) return {_mm256_slli_epi64(v, n)};
+        else return {_mm256_srli_epi64(v, -n)};
+    }
+    Lanes nonzero() const { return ~Lanes {_mm256_cmpeq_epi64(v, _mm256_setzero_si256())}; }
+    bool any() const { return !_mm256_testz_si256(v, v); }
+    Lanes popcount() const { // per nibble from a table, then summed per lane
+        __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+                                        _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+        return {_mm256_sad_epu8(bytes, _mm256_setzero_si256())};
+    }
+};
+#else
+struct Lanes {
+    uint64_t v;
+    static constexpr size_t width = 1;
+
+    static Lanes load(const Squares *p) { return {*p}; }
+    void store(Squares *p) const { *p = v; }
+    static Lanes all(Squares x) { return {x}; }
+
+    Lanes operator&(Lanes o) const { return {v & o.v}; }
+    Lanes operator|(Lanes o) const { return {v | o.v}; }
+    Lanes operator+(Lanes o) const { return {v + o.v}; }
+    Lanes operator-(Lanes o) const { return {v - o.v}; }
+    Lanes operator~() const { return {~v}; }
+
+    template<int n> Lanes shift() const {
+        if constexpr (n > 0) return {v << n};
+        else return {v >> -n};
+    }
+    Lanes nonzero() const { return {v ? ~0ULL : 0}; }
+    bool any() const { return v; }
+    Lanes popcount() const { return {(uint64_t) _popcnt64(v)}; }
+};
+#endif
+
+Lanes &operator|=(Lanes &a, Lanes b) { return a = a | b; }
+Lanes &operator+=(Lanes &a, Lanes b) { return a = a + b; }
+
+// one square step per direction of lookup.h, and the knight jumps with the files they may land on
+constexpr int stepShift[8] {8, -8, 1, -1, 9, -9, 7, -7};
+constexpr int jumpShift[8] {17, 15, 10, 6, -17, -15, -10, -6};
+constexpr Squares notABfile = 0xfcfcfcfcfcfcfcfcULL;
+constexpr Squares notGHfile = 0x3f3f3f3f3f3f3f3fULL;
+constexpr Squares jumpWrap[8] {notAfile, notHfile, notABfile, notGHfile, notHfile, notAfile, notGHfile, notABfile};
+
+template<int d>
+Lanes step(Lanes x) { return x.shift<stepShift[d]>() & Lanes::all(fillWrap[d]); }
+
+template<int j>
+Lanes jump(Lanes x) { return x.shift<jumpShift[j]>() & Lanes::all(jumpWrap[j]); }
+
+// the Kogge-Stone fill of fill.h on shifts: squares attacked in direction d by gen, sliding through pro
+template<int d>
+Lanes slideFill(Lanes gen, Lanes pro) {
+    constexpr int s = stepShift[d];
+    Lanes wrap = Lanes::all(fillWrap[d]);
+    pro = pro & wrap;
+    gen |= pro & gen.shift<s>();
+    pro = pro & pro.shift<s>();
+    gen |= pro & gen.shift<2 * s>();
+    pro = pro & pro.shift<2 * s>();
+    gen |= pro & gen.shift<4 * s>();
+    return gen.shift<s>() & wrap;
+}
+
+template<typename F>
+void eachDirection(F &&f) {
+    [&]<int... d>(std::integer_sequence<int, d...>) { (f.template operator()<d>(), ...); }(std::make_integer_sequence<int, 8>());
+}
+
+Lanes kingSpread(Lanes king) {
+    Lanes res = Lanes::all(0);
+    eachDirection([&]<int d>() { res |= step<d>(king); });
+    return res;
+}
+
+Lanes knightSpread(Lanes knights) {
+    Lanes res = Lanes::all(0);
+    eachDirection([&]<int j>() { res |= jump<j>(knights); });
+    return res;
+}
+
+// check() and countMoves<true, ...>() set-wise on Lanes::width positions starting at i. Moves are counted per
+// direction: along one direction every square is reached by at most one own slider, the nearest one behind
+// it, and by at most one knight per jump, so the popcounts of the fills add up to the per piece counts
+void countLanes(const Squares *const *field, size_t i, Squares *counts, Squares *seenOut) {
+    auto at = [&](int f) { return Lanes::load(field[f] + i); };
+    Lanes k = at(BoardBatch::SELF_K), q = at(BoardBatch::SELF_Q), r = at(BoardBatch::SELF_R);
+    Lanes b = at(BoardBatch::SELF_B), n = at(BoardBatch::SELF_N), p = at(BoardBatch::SELF_P);
+    Lanes ek = at(BoardBatch::ENEMY_K), eq = at(BoardBatch::ENEMY_Q), er = at(BoardBatch::ENEMY_R);
+    Lanes eb = at(BoardBatch::ENEMY_B), en = at(BoardBatch::ENEMY_N), epawn = at(BoardBatch::ENEMY_P);
+    Lanes zero = Lanes::all(0);
+
+    Lanes selfOcc = k | q | r | b | n | p;
+    Lanes enemyOcc = ek | eq | er | eb | en | epawn;
+    Lanes occ = selfOcc | enemyOcc, empty = ~occ, occNotKing = occ & ~k;
+    Lanes rookLike = er | eq, bishopLike = eb | eq;
+
+    // status, as in sliderFill()
+    Lanes enemyRays[8], kingRays[8], pinRays[8];
+    Lanes seen = zero, checkers = zero, checkRays = zero, kingBan = zero;
+    eachDirection([&]<int d>() {
+        Lanes sliders = d < 4 ? rookLike : bishopLike;
+        enemyRays[d] = slideFill<d>(sliders, empty);
+        kingRays[d] = slideFill<d>(k, empty);
+        seen |= enemyRays[d];
+        Lanes checker = kingRays[d] & sliders;
+        Lanes checking = checker.nonzero();
+        checkers |= checker;
+        checkRays |= kingRays[d] & checking;
+        kingBan |= step<d ^ 1>(k) & checking; // the square behind the king, the only one of kingBan it can move to
+    });
+    Lanes pinHV = zero, pinD = zero;
+    eachDirection([&]<int d>() {
+        Lanes pinned = kingRays[d] & occNotKing & enemyRays[d ^ 1];
+        pinRays[d] = slideFill<d>(k & pinned.nonzero(), empty | pinned);
+        if constexpr (d < 4) pinHV |= pinRays[d];
+        else pinD |= pinRays[d];
+    });
+
+    seen |= knightSpread(en);
+    checkers |= en & knightSpread(k);
+    seen |= (epawn & Lanes::all(notAfile)).shift<-9>() | (epawn & Lanes::all(notHfile)).shift<-7>();
+    checkers |= epawn & ((k.shift<9>() & Lanes::all(notAfile)) | (k.shift<7>() & Lanes::all(notHfile)));
+    seen |= kingSpread(ek);
+    seen.store(seenOut);
+
+    // checkMask of the statusReport, emptied in double check so that only the king moves
+    Lanes inCheck = checkers.nonzero();
+    Lanes doubleCheck = (checkers & (checkers - Lanes::all(1))).nonzero();
+    Lanes checkMask = (((checkRays | checkers) & inCheck) | ~inCheck) & ~doubleCheck;
+
+    Lanes notSelf = ~selfOcc;
+    Lanes targets = notSelf & checkMask;
+    Lanes notpin = ~(pinHV | pinD);
+
+    Lanes count = (kingSpread(k) & ~kingBan & ~seen & notSelf).popcount();
+
+    // sliders, a pinned one only along the line of its pin
+    eachDirection([&]<int d>() {
+        Lanes movers = (d < 4 ? r | q : b | q) & (notpin | pinRays[d] | pinRays[d ^ 1]);
+        count += (slideFill<d>(movers, empty) & targets).popcount();
+    });
+    Lanes knights = n & notpin;
+    eachDirection([&]<int j>() { count += (jump<j>(knights) & targets).popcount(); });
+
+    // pawns, as in countMoves<true, ...>()
+    {
+        Lanes notLast = Lanes::all(~wPawnLast), last = Lanes::all(wPawnLast);
+        Lanes leftTargets = (enemyOcc & Lanes::all(notHfile)).shift<-7>();
+        Lanes rightTargets = (enemyOcc & Lanes::all(notAfile)).shift<-9>();
+        Lanes pawnAdvance = p & notLast & ~occ.shift<-8>();
+        Lanes pawnPush = pawnAdvance & Lanes::all(wPawnStart) & ~occ.shift<-16>();
+        Lanes pawnCaptureL = p & notLast & leftTargets;
+        Lanes pawnCaptureR = p & notLast & rightTargets;
+        Lanes pawnAdvancePromote = p & last & ~occ.shift<-8>();
+        Lanes pawnCaptureLpromote = p & last & leftTargets;
+        Lanes pawnCaptureRpromote = p & last & rightTargets;
+
+        Lanes advance = (pawnAdvance & notpin).shift<8>() | ((pawnAdvance & pinHV).shift<8>() & pinHV);
+        Lanes push = (pawnPush & notpin).shift<16>() | ((pawnPush & pinHV).shift<16>() & pinHV);
+        Lanes captureL = (pawnCaptureL & notpin).shift<7>() | ((pawnCaptureL & pinD).shift<7>() & pinD);
+        Lanes captureR = (pawnCaptureR & notpin).shift<9>() | ((pawnCaptureR & pinD).shift<9>() & pinD);
+        Lanes advancePromote = (pawnAdvancePromote & notpin).shift<8>() | ((pawnAdvancePromote & pinHV).shift<8>() & pinHV);
+        Lanes captureLpromote = (pawnCaptureLpromote & notpin).shift<7>() | ((pawnCaptureLpromote & pinD).shift<7>() & pinD);
+        Lanes captureRpromote = (pawnCaptureRpromote & notpin).shift<9>() | ((pawnCaptureRpromote & pinD).shift<9>() & pinD);
+
+        count += (advance & targets).popcount() + (push & targets).popcount();
+        count += (captureL & targets).popcount() + (captureR & targets).popcount();
+        Lanes promotions = (advancePromote & targets).popcount() + (captureLpromote & targets).popcount() + (captureRpromote & targets).popcount();
+        count += promotions.shift<2>();
+    }
+
+    // enpassant, the masks subtract one per legal capture
+    Lanes epPawn = at(BoardBatch::EP);
+    if (epPawn.any()) {
+        // epPin of check(): two pieces between the king and an enemy rook or queen on its rank
+        Lanes epPin = zero;
+        eachDirection([&]<int d>() {
+            if constexpr (d == 2 || d == 3) {
+                Lanes first = kingRays[d] & occ;
+                Lanes second = slideFill<d>(first, empty) & occ;
+                Lanes pinner = slideFill<d>(second, empty) & rookLike;
+                epPin |= (first | second) & p & pinner.nonzero();
+            }
+        });
+
+        Lanes enemyPawnBehind = epPawn.shift<8>();
+        Lanes possible = (epPawn & ~pinD).nonzero() & ((enemyPawnBehind | epPawn) & targets).nonzero();
+        Lanes behindPinned = (enemyPawnBehind & pinD).nonzero();
+        auto legal = [&](Lanes pawn) {
+            pawn = pawn & p & ~epPin & ~pinHV;
+            return possible & ((pawn & ~pinD).nonzero() | ((pawn & pinD).nonzero() & behindPinned));
+        };
+        count = count - legal((epPawn & Lanes::all(notAfile)).shift<-1>());
+        count = count - legal((epPawn & Lanes::all(notHfile)).shift<1>());
+    }
+
+    // castles
+    Lanes noCheck = ~inCheck;
+    Lanes castleL = ((occ & Lanes::all(wLCastleEmpty)) | (seen & Lanes::all(wLCastleSeen))).nonzero();
+    Lanes castleR = ((occ & Lanes::all(wRCastleEmpty)) | (seen & Lanes::all(wRCastleSeen))).nonzero();
+    count = count - (noCheck & at(BoardBatch::CASTLE_L) & ~castleL);
+    count = count - (noCheck & at(BoardBatch::CASTLE_R) & ~castleR);
+
+    count.store(counts);
+}
+
+} // namespace
+
+#if defined(BATCH_AVX512) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+void BoardBatch::clear() {
+    for (auto &f : fields) f.clear();
+    mirrored.clear();
+}
+
+void BoardBatch::push(const Board &board) {
+    bool white = board.state.isWhite;
+    const Pieces &self = white ? board.w : board.b;
+    const Pieces &enemy = white ? board.b : board.w;
+    auto orient = [&](Squares x) { return white ? x : _bswap64(x); };
+
+    const Squares values[FIELDS] {
+        self.k, self.q, self.r, self.b, self.n, self.p,
+        enemy.k, enemy.q, enemy.r, enemy.b, enemy.n, enemy.p,
+        board.state.ep ? board.ep : 0,
+        (white ? board.state.wL : board.state.bL) ? ~0ULL : 0,
+        (white ? board.state.wR : board.state.bR) ? ~0ULL : 0,
+    };
+    for (int f = 0; f < FIELDS; f++) fields[f].push_back(f < CASTLE_L ? orient(values[f]) : values[f]);
+    mirrored.push_back(!white);
+}
+
+void countBatch(const BoardBatch &batch, uint64_t *counts, Squares *seen) {
+    size_t size = batch.size(), full = size - size % Lanes::width;
+    const Squares *field[BoardBatch::FIELDS];
+    for (int f = 0; f < BoardBatch::FIELDS; f++) field[f] = batch.fields[f].data();
+    for (size_t i = 0; i < full; i += Lanes::width) countLanes(field, i, counts + i, seen + i);
+
+    // the last positions, padded with empty boards
+    if (full < size) {
+        Squares tail[BoardBatch::FIELDS][Lanes::width] {};
+        Squares tailCounts[Lanes::width], tailSeen[Lanes::width];
+        for (int f = 0; f < BoardBatch::FIELDS; f++) {
+            for (size_t i = full; i < size; i++) tail[f][i - full] = field[f][i];
+            field[f] = tail[f];
+        }
+        countLanes(field, 0, tailCounts, tailSeen);
+        for (size_t i = full; i < size; i++) {
+            counts[i] = tailCounts[i - full];
+            seen[i] = tailSeen[i - full];
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        if (batch.mirrored[i]) seen[i] = _bswap64(seen[i]);
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "bitboard.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// many independent positions in structure of arrays form, for counting their legal moves across the lanes of
+// a vector: field f of position i is fields[f][i], so one load takes the same bitboard of consecutive
+// positions. Positions are stored from the side to move. Black to move ones are mirrored vertically (a byte
+// swap of every bitboard) with the colours exchanged, so every lane generates white moves
+struct BoardBatch {
+    enum Field {
+        SELF_K, SELF_Q, SELF_R, SELF_B, SELF_N, SELF_P,
+        ENEMY_K, ENEMY_Q, ENEMY_R, ENEMY_B, ENEMY_N, ENEMY_P,
+        EP, // the pawn e.p. can capture, 0 when there is none
+        CASTLE_L, CASTLE_R, // all ones with the castle right of the side to move
+        FIELDS
+    };
+
+    std::vector<Squares> fields[FIELDS];
+    std::vector<bool> mirrored;
+
+    size_t size() const { return mirrored.size(); }
+    void clear();
+    void push(const Board &board);
+};
+
+// counts[i] = countMoves() of position i, seen[i] = its statusReport::enemySeen, in the orientation of the
+// board that was pushed. The lanes are 8 positions with AVX-512, 4 with AVX2 and 1 otherwise, see batch.cpp
+void countBatch(const BoardBatch &batch, uint64_t *counts, Squares *seen);
+
+extern const char *batchBackend;
@@ -0,0 +1,544 @@
+#include "corpus.h"
+#include "batch.h"
+#include "stats.h"
+#include "packed.h"
+#include "parallel.h"
+#include "pgn.h"
+#include "mapped.h"
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <memory>
+#include <unistd.h>
+
+// perft regression and throughput benchmark; tests holds the correctness checks.
+// bench [-f FILE] [-d MAX_DEPTH] [-r REPEATS] [-H HASH_MB] [-o text|json|csv] [-m template|dispatch|scratch|attacks|fill|quad] [-q PLIES] [-t THREADS] [-S SPLIT] [-s] [-b] [-F] [-P] [-G] [-L] [-i STATS_FILE]
+// Every line of the EPD file is a FEN followed by the expected counts, "FEN ;D1 20 ;D2 400 ...".
+// All depths up to MAX_DEPTH are checked, the deepest one is run REPEATS times and timed.
+// -m dispatch runs perftDispatch instead of the templated perft, scratch, attacks and fill the runtime
+// dispatched attackPerft with check(), the incremental AttackTable or checkFill(), quad the same walk as
+// scratch on QuadBoards.
+// -t runs the template walk through parallelPerft on a pool of THREADS workers, split SPLIT plies below the
+// root (default 2), to time its scaling against -t 1.
+// -q times the quiescence workload instead, capture trees PLIES deep below perft MAX_DEPTH (default 2),
+// with staged generation against ALL filtered to the captures, or with -m attacks|fill, that source
+// against check() on the staged walk.
+// -s times check() against checkFill() with the scalar and the vector fill, on every node of the perft
+// trees down to MAX_DEPTH (default 3).
+// -b counts the moves of the same nodes with countBatch() against status() and countMoves() one board at a time.
+// -F times writeFEN() and readFEN() on the same nodes.
+// -P writes them to a PackedBoard file and times reading it against readFEN() and parseFEN().
+// -G replays a synthetic PGN file of random games, one from each of the nodes at MAX_DEPTH (default 1), on one
+// thread and on the pool.
+// -L times isLegal() on the nodes down to MAX_DEPTH (default 2) against generating every move.
+// -i writes the counters of an instrumented build (BITBOARD_STATS) as JSON to STATS_FILE, - for stdout.
+// The exit code is 1 when a perft count is wrong or the two quiescence walks disagree
+
+struct BenchResult {
+    std::string fen;
+    int depth;
+    uint64_t nodes;
+    uint64_t expected;
+    bool ok; // every checked depth matched
+    std::vector<double> times; // seconds, one per repeat
+    double median;
+    double variance;
+};
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+double variance(const std::vector<double> &values) {
+    if (values.size() < 2) return 0;
+    double mean = 0;
+    for (auto v : values) mean += v;
+    mean /= values.size();
+    double sum = 0;
+    for (auto v : values) sum += (v - mean) * (v - mean);
+    return sum / (values.size() - 1);
+}
+
+// the table is cleared before every run, so repeats do not read each other's results
+std::string mode = "template";
+WorkStealingPool *pool = nullptr; // set by -t, created once outside the timed runs
+int splitDepth = 2;
+
+uint64_t timedPerft(int depth, Board board, size_t hashMB, double &seconds) {
+    perftTable.resize(hashMB);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    uint64_t nodes = runPerft(mode, depth, board, pool, splitDepth);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    seconds = std::chrono::duration<double>(end_time - start_time).count();
+    return nodes;
+}
+
+BenchResult runEntry(const EpdEntry &entry, int maxDepth, int repeats, size_t hashMB) {
+    Board board = parseFEN(entry.fen);
+    BenchResult result {entry.fen, 0, 0, 0, true, {}, 0, 0};
+
+    for (auto [depth, expected] : entry.expected) {
+        if (depth > maxDepth) continue;
+        double seconds;
+        uint64_t nodes = timedPerft(depth, board, hashMB, seconds);
+        if (nodes != expected) {
+            result.ok = false;
+            std::cerr << "Error: " << entry.fen << " depth " << depth << ": " << nodes << ", expected " << expected << std::endl;
+        }
+        if (depth > result.depth) result = {entry.fen, depth, nodes, expected, result.ok, {seconds}, 0, 0};
+    }
+
+    for (int i = 1; i < repeats && result.depth; i++) {
+        double seconds;
+        timedPerft(result.depth, board, hashMB, seconds);
+        result.times.push_back(seconds);
+    }
+    if (result.depth) {
+        result.median = median(result.times);
+        result.variance = variance(result.times);
+    }
+    return result;
+}
+
+double nps(uint64_t nodes, double seconds) { return seconds > 0 ? nodes / seconds : 0; }
+
+void printText(const std::vector<BenchResult> &results, uint64_t nodes, double seconds, bool ok) {
+    for (auto &r : results) {
+        std::cout << (r.ok ? "ok   " : "FAIL ") << "d" << r.depth << " " << std::setw(12) << r.nodes
+                  << " " << std::setw(10) << std::fixed << std::setprecision(6) << r.median << " s"
+                  << " " << std::setw(8) << std::setprecision(2) << nps(r.nodes, r.median) / 1e6 << " Mnps  " << r.fen << std::endl;
+    }
+    std::cout << (ok ? "ok" : "FAIL") << " total " << nodes << " nodes, " << std::setprecision(6) << seconds << " s, "
+              << std::setprecision(2) << nps(nodes, seconds) / 1e6 << " Mnps" << std::endl;
+}
+
+void printJSON(const std::vector<BenchResult> &results, uint64_t nodes, double seconds, bool ok) {
+    std::cout << std::setprecision(9) << "{\"positions\": [" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &r = results[i];
+        std::cout << "  {\"fen\": \"" << r.fen << "\", \"depth\": " << r.depth << ", \"nodes\": " << r.nodes
+                  << ", \"expected\": " << r.expected << ", \"ok\": " << (r.ok ? "true" : "false")
+                  << ", \"median_s\": " << r.median << ", \"variance_s2\": " << r.variance
+                  << ", \"nps\": " << (uint64_t) nps(r.nodes, r.median) << ", \"times_s\": [";
+        for (size_t j = 0; j < r.times.size(); j++) std::cout << (j ? ", " : "") << r.times[j];
+        std::cout << "]}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    std::cout << "], \"total\": {\"nodes\": " << nodes << ", \"seconds\": " << seconds
+              << ", \"nps\": " << (uint64_t) nps(nodes, seconds) << ", \"ok\": " << (ok ? "true" : "false") << "}}" << std::endl;
+}
+
+void printCSV(const std::vector<BenchResult> &results, uint64_t nodes, double seconds, bool ok) {
+    std::cout << std::setprecision(9) << "fen,depth,nodes,expected,ok,median_s,variance_s2,nps" << std::endl;
+    for (auto &r : results) {
+        std::cout << "\"" << r.fen << "\"," << r.depth << "," << r.nodes << "," << r.expected << "," << r.ok << ","
+                  << r.median << "," << r.variance << "," << (uint64_t) nps(r.nodes, r.median) << std::endl;
+    }
+    std::cout << "total,," << nodes << ",," << ok << "," << seconds << ",," << (uint64_t) nps(nodes, seconds) << std::endl;
+}
+
+struct QuiescenceResult {
+    std::string fen;
+    QuiescenceCounts first;
+    QuiescenceCounts second;
+    double firstTime; // median seconds
+    double secondTime;
+    bool ok;
+};
+
+QuiescenceResult runQuiescence(const EpdEntry &entry, int depth, int plies, int repeats) {
+    Board board = parseFEN(entry.fen);
+    QuiescenceResult result {entry.fen, {}, {}, 0, 0, true};
+    std::vector<double> firstTimes, secondTimes;
+
+    // interleaved, so a slow stretch of the machine hits both the same
+    for (int i = 0; i < repeats; i++) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        result.first = firstWalk(mode, depth, plies, board);
+        auto mid_time = std::chrono::high_resolution_clock::now();
+        result.second = secondWalk(mode, depth, plies, board);
+        auto end_time = std::chrono::high_resolution_clock::now();
+        firstTimes.push_back(std::chrono::duration<double>(mid_time - start_time).count());
+        secondTimes.push_back(std::chrono::duration<double>(end_time - mid_time).count());
+    }
+    result.firstTime = median(firstTimes);
+    result.secondTime = median(secondTimes);
+
+    result.ok = result.first.nodes == result.second.nodes && !result.first.errors && !result.second.errors;
+    if (!result.ok) {
+        std::cerr << "Error: " << entry.fen << ": " << result.first.nodes << " and " << result.second.nodes << " nodes, "
+                  << result.first.errors + result.second.errors << " nodes with stages not adding up to ALL" << std::endl;
+    }
+    return result;
+}
+
+int quiescenceMain(const std::vector<EpdEntry> &entries, int depth, int plies, int repeats) {
+    std::string first = !attackWalks(mode) ? "staged" : mode == "fill" ? "fill" : "attacks";
+    std::string second = attackWalks(mode) ? "scratch" : "all";
+    bool ok = true;
+    uint64_t nodes = 0, dropped = 0;
+    double firstTime = 0, secondTime = 0;
+    for (auto &entry : entries) {
+        QuiescenceResult r = runQuiescence(entry, depth, plies, repeats);
+        ok = ok && r.ok;
+        nodes += r.first.nodes;
+        dropped += r.second.dropped;
+        firstTime += r.firstTime;
+        secondTime += r.secondTime;
+        std::cout << (r.ok ? "ok   " : "FAIL ") << std::setw(12) << r.first.nodes << " nodes " << std::setw(12) << r.second.dropped << " dropped "
+                  << std::fixed << std::setprecision(6) << std::setw(10) << r.firstTime << " s " << first << " " << std::setw(10) << r.secondTime << " s " << second << "  "
+                  << std::setprecision(2) << r.secondTime / r.firstTime << "x  " << r.fen << std::endl;
+    }
+    std::cout << (ok ? "ok" : "FAIL") << " total " << nodes << " nodes, " << dropped << " quiet moves dropped, "
+              << std::setprecision(6) << firstTime << " s " << first << ", " << secondTime << " s " << second << ", "
+              << std::setprecision(2) << secondTime / firstTime << "x" << std::endl;
+    return ok ? 0 : 1;
+}
+
+// best of the repeats, in seconds
+template<typename F>
+double timeBest(int repeats, F &&f) {
+    double best = 0;
+    for (int i = 0; i < repeats; i++) {
+        auto start_time = std::chrono::high_resolution_clock::now();
+        f();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        double seconds = std::chrono::duration<double>(end_time - start_time).count();
+        if (!i || seconds < best) best = seconds;
+    }
+    return best;
+}
+
+// best of the repeats, in ns per node; sink keeps the reports alive
+template<int kind>
+double timeStatus(std::vector<Board> &nodes, int repeats, uint64_t &sink) {
+    double best = timeBest(repeats, [&]() {
+        for (auto &node : nodes) {
+            statusReport res = statusOf<kind>(node);
+            sink += res.enemySeen ^ res.pinHV ^ res.pinD ^ res.checkMask;
+        }
+    });
+    return best * 1e9 / nodes.size();
+}
+
+int statusMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    uint64_t sink = 0;
+    double perPiece = timeStatus<0>(nodes, repeats, sink);
+    double scalar = timeStatus<1>(nodes, repeats, sink);
+    double vector = timeStatus<2>(nodes, repeats, sink);
+    std::cout << std::fixed << std::setprecision(2) << nodes.size() << " nodes (" << sink % 2 << ")" << std::endl
+              << "check()              " << std::setw(8) << perPiece << " ns/node" << std::endl
+              << "checkFill() scalar   " << std::setw(8) << scalar << " ns/node" << std::endl
+              << "checkFill() " << std::left << std::setw(9) << fillBackend << std::right << std::setw(8) << vector << " ns/node" << std::endl;
+    return 0;
+}
+
+int fenMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    size_t n = nodes.size();
+    std::vector<char> text(n * MAX_FEN);
+    std::vector<size_t> lengths(n);
+    std::vector<Board> parsed(n);
+    std::vector<FenClocks> parsedClocks(n);
+    auto write = [&]() {
+        for (size_t i = 0; i < n; i++) lengths[i] = writeFEN(nodes[i], &text[i * MAX_FEN], nodeClocks(i));
+    };
+    auto read = [&]() {
+        for (size_t i = 0; i < n; i++) readFEN({&text[i * MAX_FEN], lengths[i]}, parsed[i], &parsedClocks[i]);
+    };
+
+    double written = timeBest(repeats, write);
+    double readTime = timeBest(repeats, read);
+    size_t bytes = 0;
+    for (size_t length : lengths) bytes += length;
+    std::cout << std::fixed << std::setprecision(2) << n << " FENs, " << double(bytes) / n << " bytes each" << std::endl
+              << "writeFEN    " << std::setw(8) << n / written / 1e6 << " M/s" << std::endl
+              << "readFEN     " << std::setw(8) << n / readTime / 1e6 << " M/s" << std::endl
+              << "round trip  " << std::setw(8) << n / (written + readTime) / 1e6 << " M/s" << std::endl;
+    return 0;
+}
+
+// -P: the nodes written to a PackedBoard file and read back through the mapping, timed against readFEN() and
+// parseFEN() on the FENs of the same nodes
+int packedMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    size_t n = nodes.size();
+    std::string path = (std::filesystem::temp_directory_path() / ("bitboard-bench-" + std::to_string(getpid()) + ".packed")).string();
+    {
+        PackedWriter writer(path);
+        for (size_t i = 0; i < n; i++) writer.write(nodes[i], nodeClocks(i));
+        if (!writer.close()) {
+            std::cerr << "Error: cannot write " << path << std::endl;
+            return 2;
+        }
+    }
+    PackedReader reader(path);
+    std::filesystem::remove(path); // the mapping stays valid
+
+    std::vector<Board> unpacked(n);
+    std::vector<std::string> fens(n);
+    size_t fenBytes = 0;
+    for (size_t i = 0; i < n; i++) {
+        fens[i] = toFEN(nodes[i], nodeClocks(i));
+        fenBytes += fens[i].size() + 1;
+    }
+    WorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    constexpr size_t JOB = 4096;
+    double packed = timeBest(repeats, [&]() {
+        for (size_t i = 0; i < n; i++) reader.board(i, unpacked[i]);
+    });
+    double threaded = timeBest(repeats, [&]() {
+        pool.run((n + JOB - 1) / JOB, [&](size_t job) {
+            for (size_t i = job * JOB; i < std::min(n, (job + 1) * JOB); i++) reader.board(i, unpacked[i]);
+        });
+    });
+    double fen = timeBest(repeats, [&]() {
+        for (size_t i = 0; i < n; i++) readFEN(fens[i], unpacked[i]);
+    });
+    double parsed = timeBest(repeats, [&]() {
+        for (size_t i = 0; i < n; i++) unpacked[i] = parseFEN(fens[i]);
+    });
+    std::cout << std::fixed << std::setprecision(2) << n << " positions, " << sizeof(PackedBoard) << " bytes each against "
+              << double(fenBytes) / n << " of FEN" << std::endl
+              << "PackedReader           " << std::setw(8) << n / packed / 1e6 << " M/s" << std::endl
+              << "PackedReader " << std::setw(2) << pool.size() << " threads " << std::setw(8) << n / threaded / 1e6 << " M/s" << std::endl
+              << "readFEN()              " << std::setw(8) << n / fen / 1e6 << " M/s" << std::endl
+              << "parseFEN()             " << std::setw(8) << n / parsed / 1e6 << " M/s" << std::endl;
+    return 0;
+}
+
+// -G: random games from every node written to a PGN file, mapped, split and replayed on one thread and on the
+// pool
+int pgnMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    size_t n = nodes.size();
+    std::string pgn;
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    for (size_t i = 0; i < n; i++) {
+        Board final;
+        pgn += randomGame(nodes[i], seed, final);
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / ("bitboard-bench-" + std::to_string(getpid()) + ".pgn")).string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(pgn.data(), pgn.size());
+        if (!out.flush()) {
+            std::cerr << "Error: cannot write " << path << std::endl;
+            return 2;
+        }
+    }
+    MappedFile file(path);
+    std::filesystem::remove(path); // the mapping stays valid
+    std::string_view text = file.view();
+
+    std::vector<Board> replayed(n);
+    std::vector<PgnStatus> results(n);
+    auto replay = [&](std::vector<std::string_view> &games, size_t i) {
+        results[i] = replayGame(games[i], [&](const Board &board, FenClocks) { replayed[i] = board; });
+    };
+    std::vector<std::string_view> games;
+    WorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    constexpr size_t JOB = 16;
+    double single = timeBest(repeats, [&]() {
+        games = splitGames(text);
+        for (size_t i = 0; i < n; i++) replay(games, i);
+    });
+    double threaded = timeBest(repeats, [&]() {
+        games = splitGames(text);
+        pool.run((n + JOB - 1) / JOB, [&](size_t job) {
+            for (size_t i = job * JOB; i < std::min(n, (job + 1) * JOB); i++) replay(games, i);
+        });
+    });
+    double split = timeBest(repeats, [&]() { games = splitGames(text); });
+    uint64_t totalPlies = 0;
+    for (auto &result : results) totalPlies += result.plies;
+    std::cout << std::fixed << std::setprecision(2) << n << " games, " << totalPlies << " plies, "
+              << text.size() / 1e6 << " MB" << std::endl
+              << "splitGames()         " << std::setw(10) << n / split / 1e3 << " k games/s" << std::endl
+              << "replay               " << std::setw(10) << n / single / 1e3 << " k games/s " << std::setw(8) << totalPlies / single / 1e6 << " M plies/s" << std::endl
+              << "replay " << std::setw(2) << pool.size() << " threads    " << std::setw(10) << n / threaded / 1e3 << " k games/s " << std::setw(8) << totalPlies / threaded / 1e6 << " M plies/s" << std::endl;
+    return 0;
+}
+
+// -L: every legal move of every node, the moves of the next node and random encodings, isLegal() timed against
+// generating the moves or the children of the node
+int legalMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    std::vector<Candidate> candidates = moveCandidates(nodes);
+    size_t m = candidates.size();
+    uint64_t legalCount = 0;
+    for (auto &candidate : candidates) legalCount += candidate.legal;
+
+    // the child each pseudoLegal candidate would give, what a server comparing children looks for
+    std::vector<Board> targets(m);
+    for (size_t i = 0; i < m; i++) {
+        if (pseudoLegal(nodes[candidates[i].node], candidates[i].move)) targets[i] = nodes[candidates[i].node].makeMove(candidates[i].move);
+    }
+    uint64_t sink = 0;
+    double legal = timeBest(repeats, [&]() {
+        for (auto &candidate : candidates) sink += isLegal(nodes[candidate.node], candidate.move);
+    });
+    double pseudo = timeBest(repeats, [&]() {
+        for (auto &candidate : candidates) sink += pseudoLegal(nodes[candidate.node], candidate.move);
+    });
+    double list = timeBest(repeats, [&]() {
+        Move moves[MAX_MOVES];
+        for (auto &candidate : candidates) {
+            int count = generateMoveList(nodes[candidate.node], moves);
+            sink += std::find(moves, moves + count, candidate.move) != moves + count;
+        }
+    });
+    double children = timeBest(repeats, [&]() {
+        for (size_t i = 0; i < m; i++) {
+            std::vector<Board> boards = generateMoves(nodes[candidates[i].node]);
+            sink += std::any_of(boards.begin(), boards.end(), [&](const Board &child) { return sameBoard(child, targets[i]); });
+        }
+    });
+    std::cout << std::fixed << std::setprecision(2) << m << " moves, " << legalCount << " legal ("
+              << sink % 2 << ")" << std::endl
+              << "isLegal()                " << std::setw(8) << m / legal / 1e6 << " M/s" << std::endl
+              << "pseudoLegal()            " << std::setw(8) << m / pseudo / 1e6 << " M/s" << std::endl
+              << "generateMoveList(), find " << std::setw(8) << m / list / 1e6 << " M/s" << std::endl
+              << "generateMoves(), compare " << std::setw(8) << m / children / 1e6 << " M/s" << std::endl;
+    return 0;
+}
+
+int batchMain(const std::vector<EpdEntry> &entries, int depth, int repeats) {
+    std::vector<Board> nodes = collectNodes(entries, depth);
+    BoardBatch batch;
+    for (auto &node : nodes) batch.push(node);
+
+    std::vector<uint64_t> counts(nodes.size()), scalarCounts(nodes.size());
+    std::vector<Squares> seen(nodes.size()), scalarSeen(nodes.size());
+    auto scalar = [&]() {
+        for (size_t i = 0; i < nodes.size(); i++) {
+            withState(nodes[i], [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+                statusReport res = status<isWhite, ep>(nodes[i]);
+                scalarCounts[i] = countMoves<isWhite, ep, wL, wR, bL, bR>(nodes[i], res);
+                scalarSeen[i] = res.enemySeen;
+            });
+        }
+    };
+    auto batched = [&]() { countBatch(batch, counts.data(), seen.data()); };
+
+    double scalarRate = nodes.size() / timeBest(repeats, scalar);
+    double batchRate = nodes.size() / timeBest(repeats, batched);
+    double packRate = nodes.size() / timeBest(repeats, [&]() {
+        batch.clear();
+        for (auto &node : nodes) batch.push(node);
+    });
+    std::cout << std::fixed << std::setprecision(2) << nodes.size() << " nodes" << std::endl
+              << "countMoves()         " << std::setw(8) << scalarRate / 1e6 << " M positions/s" << std::endl
+              << "countBatch() " << std::left << std::setw(8) << batchBackend << std::right << std::setw(8) << batchRate / 1e6 << " M positions/s" << std::endl
+              << "BoardBatch::push()   " << std::setw(8) << packRate / 1e6 << " M positions/s" << std::endl;
+    return 0;
+}
+
+int perftMain(const std::vector<EpdEntry> &entries, int maxDepth, int repeats, size_t hashMB, const std::string &format) {
+    std::vector<BenchResult> results;
+    uint64_t nodes = 0;
+    double seconds = 0; // sum of the medians
+    bool ok = true;
+    for (auto &entry : entries) {
+        BenchResult r = runEntry(entry, maxDepth, repeats, hashMB);
+        if (!r.depth) continue;
+        nodes += r.nodes;
+        seconds += r.median;
+        ok = ok && r.ok;
+        results.push_back(r);
+    }
+
+    if (format == "json") printJSON(results, nodes, seconds, ok);
+    else if (format == "csv") printCSV(results, nodes, seconds, ok);
+    else printText(results, nodes, seconds, ok);
+
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    std::string path = "perft.epd";
+    std::string format = "text";
+    int maxDepth = 0; // every depth of the file, 2 for -q, 3 for -s, -b, -F and -P, 2 for -L, 1 for -G
+    int plies = -1;
+    int repeats = 5;
+    size_t hashMB = 0;
+    int threads = 0;
+    bool statusOnly = false;
+    bool batchOnly = false;
+    bool fenOnly = false;
+    bool packedOnly = false;
+    bool pgnOnly = false;
+    bool legalOnly = false;
+    std::string statsPath; // - for stdout
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue) path = argv[++i];
+        else if (arg == "-d" && hasValue) maxDepth = atoi(argv[++i]);
+        else if (arg == "-r" && hasValue) repeats = atoi(argv[++i]);
+        else if (arg == "-H" && hasValue) hashMB = atoi(argv[++i]);
+        else if (arg == "-o" && hasValue) format = argv[++i];
+        else if (arg == "-m" && hasValue) mode = argv[++i];
+        else if (arg == "-q" && hasValue) plies = atoi(argv[++i]);
+        else if (arg == "-i" && hasValue) statsPath = argv[++i];
+        else if (arg == "-t" && hasValue) threads = atoi(argv[++i]);
+        else if (arg == "-S" && hasValue) splitDepth = atoi(argv[++i]);
+        else if (arg == "-s") statusOnly = true;
+        else if (arg == "-b") batchOnly = true;
+        else if (arg == "-F") fenOnly = true;
+        else if (arg == "-P") packedOnly = true;
+        else if (arg == "-G") pgnOnly = true;
+        else if (arg == "-L") legalOnly = true;
+        else {
+            std::cerr << "usage: bench [-f FILE] [-d MAX_DEPTH] [-r REPEATS] [-H HASH_MB] [-o text|json|csv] [-m template|dispatch|scratch|attacks|fill|quad] [-q PLIES] [-t THREADS] [-S SPLIT] [-s] [-b] [-F] [-P] [-G] [-L] [-i STATS_FILE]" << std::endl;
+            return 2;
+        }
+    }
+
+    if (threads && mode != "template") {
+        std::cerr << "Error: -t only runs the template walk" << std::endl;
+        return 2;
+    }
+
+    std::vector<EpdEntry> entries = readEPD(path);
+    if (entries.empty()) {
+        std::cerr << "Error: no positions in " << path << std::endl;
+        return 2;
+    }
+
+    std::unique_ptr<WorkStealingPool> threadPool;
+    if (threads) {
+        threadPool = std::make_unique<WorkStealingPool>(threads);
+        pool = threadPool.get();
+    }
+
+    int code;
+    if (statusOnly) code = statusMain(entries, maxDepth ? maxDepth : 3, repeats);
+    else if (batchOnly) code = batchMain(entries, maxDepth ? maxDepth : 3, repeats);
+    else if (fenOnly) code = fenMain(entries, maxDepth ? maxDepth : 3, repeats);
+    else if (packedOnly) code = packedMain(entries, maxDepth ? maxDepth : 3, repeats);
+    else if (legalOnly) code = legalMain(entries, maxDepth ? maxDepth : 2, repeats);
+    else if (pgnOnly) code = pgnMain(entries, maxDepth ? maxDepth : 1, repeats);
+    else if (plies >= 0) code = quiescenceMain(entries, maxDepth ? maxDepth : 2, plies, repeats);
+    else code = perftMain(entries, maxDepth ? maxDepth : 100, repeats, hashMB, format);
+
+    if (statsPath == "-") dumpStats(std::cout);
+    else if (!statsPath.empty()) {
+        std::ofstream out(statsPath);
+        dumpStats(out);
+    }
+    return code;
+}
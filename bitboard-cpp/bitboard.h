@@ -0,0 +1,923 @@
+#pragma once
+
+#include "base.h"
+#include "lookup.h"
+#include "stats.h"
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <utility>
+
+#include <iostream>
+
+inline void pSq(uint64_t num) {
+    for (int row=7; row>=0; row--) {
+        for (int col=0; col<8; col++) {
+            if (num >> (8*row + col) & 0b1) std::cout << "X";
+            else std::cout << "-";           
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+struct statusReport {
+    uint64_t checkCount;
+    uint64_t kingIndex;
+    Squares checkMask;
+    Squares kingBan;
+    Squares pinHV;
+    Squares pinD;
+    Squares enemySeen;
+    Squares selfOcc;
+    Squares enemyOcc;
+    Squares epPin;
+};
+
+inline bool sameStatus(const statusReport &a, const statusReport &b) { return !memcmp(&a, &b, sizeof(a)); }
+
+#define MAX_MOVES 218 // most legal moves in any reachable position
+
+#define BitLoop(reachable) for (uint64_t temp=reachable; temp; temp=_blsr_u64(temp))
+
+template<bool isWhite, bool ep>
+statusReport check(const Pieces &self, const Pieces &enemy) {
+    Squares selfOcc = self.occupied();
+    Squares enemyOcc = enemy.occupied();
+    Squares occ = selfOcc | enemyOcc; 
+
+    Squares occNotKing = occ & ~self.k;
+
+    uint64_t kingIndex = _tzcnt_u64(self.k);
+    uint64_t checkCount = 0;
+
+    Squares checkMask = 0;
+    Squares kingBan = 0;
+    Squares pinHV = 0;
+    Squares pinD = 0;
+    Squares epPin = 0;
+
+    Squares enemySeen = 0;
+
+    for (Squares temp = enemy.r | enemy.q; temp; temp = _blsr_u64(temp)) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        Squares atk = rookMoves[pieceIndex];
+        Squares rookSeen = slide(atk, occ, pieceIndex);
+        enemySeen |= rookSeen;
+
+        Squares pin = pinRay(kingIndex, pieceIndex);
+
+        if (rookSeen & self.k) { // enemy rook can see self king, so no inbetween pieces
+            checkMask |= pin;
+            kingBan |= behindKing(kingIndex, pieceIndex);
+            checkCount++;
+        } else if (atk & self.k) { // there are pieces in the way
+            Squares inbetween = (pin ^ _blsi_u64(temp)) & occNotKing;
+            Squares onePieceRemoved = _blsr_u64(inbetween);
+            if (!onePieceRemoved) { // i.e. the enemy rook/queen is blocked by a single piece, then this piece is pinned
+                pinHV |= pin;
+            } else if (!_blsr_u64(onePieceRemoved)) { // there are two pieces in the way, therefore the only way for a piece to be pinned is that the piece is an enpassant pawn
+                if (ep && (pieceIndex/8 == kingIndex/8)) { 
+                    // there is enpassant pawn for enemy on the same file as the king
+                    epPin |= inbetween & self.p; // i.e. mask the self pawn in the pinned row so that it cannot take enpassant (if pawn exists there)
+                }
+            }
+        }
+    }
+
+    for (Squares temp = enemy.b | enemy.q; temp; temp = _blsr_u64(temp)) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        Squares atk = bishopMoves[pieceIndex];
+        Squares bishopSeen = slide(atk, occ, pieceIndex);
+        enemySeen |= bishopSeen;
+
+        Squares pin = pinRay(kingIndex, pieceIndex);
+
+        if (bishopSeen & self.k) { // enemy rook can see self king, so no inbetween pieces
+            checkMask |= pin;
+            kingBan |= behindKing(kingIndex, pieceIndex);
+            checkCount++;
+        } else if (atk & self.k) { // there are pieces in the way
+            Squares inbetween = (pin ^ _blsi_u64(temp)) & occNotKing;
+            Squares onePieceRemoved = _blsr_u64(inbetween);
+            if (!onePieceRemoved) { // i.e. the enemy bishop/queen is blocked by a single piece, then this piece is pinned
+                pinD |= pin;
+            }
+        }
+    }
+
+    for (Squares temp = enemy.n; temp; temp = _blsr_u64(temp)) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        Squares atk = knightMoves[pieceIndex];
+        enemySeen |= atk;
+
+        if (atk & self.k) {
+            checkCount++;
+            checkMask |= _blsi_u64(temp); 
+        } 
+    }
+
+    // pawns
+    Squares atkL;
+    Squares atkR;
+    if constexpr (isWhite) {
+        atkL = (enemy.p & notAfile) >> 9;
+        atkR = (enemy.p & notHfile) >> 7;
+        if (atkL & self.k) {checkMask |= (self.k << 9) & enemy.p; checkCount++;}
+        if (atkR & self.k) {checkMask |= (self.k << 7) & enemy.p; checkCount++;}
+    } else {
+        atkL = (enemy.p & notAfile) << 7;
+        atkR = (enemy.p & notHfile) << 9;
+        if (atkL & self.k) {checkMask |= (self.k >> 7) & enemy.p; checkCount++;}
+        if (atkR & self.k) {checkMask |= (self.k >> 9) & enemy.p; checkCount++;}
+    }
+    enemySeen |= atkL | atkR;
+    enemySeen |= kingMoves[_tzcnt_u64(enemy.k)];
+
+    return {checkCount, kingIndex, checkMask, kingBan, pinHV, pinD, enemySeen, selfOcc, enemyOcc, epPin};
+}
+
+// generator sinks: generate reports every legal move to its Out as a call naming the Board transition
+// that plays it, from and to are single bits. Consumers are inlined into the generator loops, so counting,
+// recursing or filtering needs no intermediate storage. PerftVisitor in perft.cpp implements the calls
+// directly, the two adapters below turn them into children or packed moves for a callable
+
+template<typename F>
+struct ChildSink { // calls f(Board &child) for every child
+    F f;
+
+    template<int piece, bool isWhite>
+    void pieceMove(Board &board, Squares from, Squares to) { emit(board.pieceMove<piece, isWhite>(from | to)); }
+
+    template<int piece, bool isWhite>
+    void pieceMoveCapture(Board &board, Squares from, Squares to) { emit(board.pieceMoveCapture<piece, isWhite>(from | to)); }
+
+    template<bool isWhite>
+    void pawnPush(Board &board, Squares from, Squares to) { emit(board.pawnPush<isWhite>(to, from | to)); }
+
+    template<bool isWhite>
+    void pawnEP(Board &board, Squares from, Squares to) { emit(board.pawnEP<isWhite>(board.ep, from | to)); }
+
+    template<bool isWhite>
+    void pawnPromote(Board &board, Squares from, Squares to) {
+        emit(board.pawnPromote<QUEEN, isWhite>(from, to));
+        emit(board.pawnPromote<ROOK, isWhite>(from, to));
+        emit(board.pawnPromote<BISHOP, isWhite>(from, to));
+        emit(board.pawnPromote<KNIGHT, isWhite>(from, to));
+    }
+
+    template<bool isWhite>
+    void pawnPromoteCapture(Board &board, Squares from, Squares to) {
+        emit(board.pawnPromoteCapture<QUEEN, isWhite>(from, to));
+        emit(board.pawnPromoteCapture<ROOK, isWhite>(from, to));
+        emit(board.pawnPromoteCapture<BISHOP, isWhite>(from, to));
+        emit(board.pawnPromoteCapture<KNIGHT, isWhite>(from, to));
+    }
+
+    template<bool isWhite>
+    void castleL(Board &board) { emit(board.castleL<isWhite>()); }
+
+    template<bool isWhite>
+    void castleR(Board &board) { emit(board.castleR<isWhite>()); }
+
+    void emit(Board child) { f(child); }
+};
+
+template<typename F>
+struct MoveSink { // calls f(Move) for every move, in the same order ChildSink reports the children
+    F f;
+
+    template<int piece, bool isWhite>
+    void pieceMove(Board &, Squares from, Squares to) { f(Move(_tzcnt_u64(from), _tzcnt_u64(to), piece, 0)); }
+
+    template<int piece, bool isWhite>
+    void pieceMoveCapture(Board &, Squares from, Squares to) { f(Move(_tzcnt_u64(from), _tzcnt_u64(to), piece, Move::CAPTURE)); }
+
+    template<bool isWhite>
+    void pawnPush(Board &, Squares from, Squares to) { f(Move(_tzcnt_u64(from), _tzcnt_u64(to), PAWN, Move::PUSH)); }
+
+    template<bool isWhite>
+    void pawnEP(Board &, Squares from, Squares to) { f(Move(_tzcnt_u64(from), _tzcnt_u64(to), PAWN, Move::CAPTURE | Move::EP)); }
+
+    template<bool isWhite>
+    void pawnPromote(Board &, Squares from, Squares to) { promote(from, to, 0); }
+
+    template<bool isWhite>
+    void pawnPromoteCapture(Board &, Squares from, Squares to) { promote(from, to, Move::CAPTURE); }
+
+    template<bool isWhite>
+    void castleL(Board &) {
+        if constexpr (isWhite) f(Move(4, 2, KING, Move::CASTLE));
+        else f(Move(60, 58, KING, Move::CASTLE));
+    }
+
+    template<bool isWhite>
+    void castleR(Board &) {
+        if constexpr (isWhite) f(Move(4, 6, KING, Move::CASTLE));
+        else f(Move(60, 62, KING, Move::CASTLE));
+    }
+
+    void promote(Squares from, Squares to, uint32_t flags) {
+        uint64_t fr = _tzcnt_u64(from), t = _tzcnt_u64(to);
+        f(Move(fr, t, PAWN, flags, QUEEN));
+        f(Move(fr, t, PAWN, flags, ROOK));
+        f(Move(fr, t, PAWN, flags, BISHOP));
+        f(Move(fr, t, PAWN, flags, KNIGHT));
+    }
+};
+
+#if defined(BOARD_STATS)
+// wraps the sink of an instrumented generate, counting the moves by moving piece
+template<typename Out>
+struct StatSink {
+    Out &out;
+
+    template<int piece, bool isWhite, typename B>
+    void pieceMove(B &board, Squares from, Squares to) { threadStats.moves[piece]++; out.template pieceMove<piece, isWhite>(board, from, to); }
+
+    template<int piece, bool isWhite, typename B>
+    void pieceMoveCapture(B &board, Squares from, Squares to) { threadStats.moves[piece]++; out.template pieceMoveCapture<piece, isWhite>(board, from, to); }
+
+    template<bool isWhite, typename B>
+    void pawnPush(B &board, Squares from, Squares to) { threadStats.moves[PAWN]++; out.template pawnPush<isWhite>(board, from, to); }
+
+    template<bool isWhite, typename B>
+    void pawnEP(B &board, Squares from, Squares to) { threadStats.moves[PAWN]++; out.template pawnEP<isWhite>(board, from, to); }
+
+    template<bool isWhite, typename B>
+    void pawnPromote(B &board, Squares from, Squares to) { threadStats.moves[PAWN] += 4; out.template pawnPromote<isWhite>(board, from, to); }
+
+    template<bool isWhite, typename B>
+    void pawnPromoteCapture(B &board, Squares from, Squares to) { threadStats.moves[PAWN] += 4; out.template pawnPromoteCapture<isWhite>(board, from, to); }
+
+    template<bool isWhite, typename B>
+    void castleL(B &board) { threadStats.moves[KING]++; out.template castleL<isWhite>(board); }
+
+    template<bool isWhite, typename B>
+    void castleR(B &board) { threadStats.moves[KING]++; out.template castleR<isWhite>(board); }
+};
+
+// the per node counters, from the report of status()
+template<bool isWhite, bool ep, typename B>
+void statNode(B &board, const statusReport &res) {
+    const Pieces &self = isWhite ? board.w : board.b;
+    Squares occ = res.selfOcc | res.enemyOcc;
+    threadStats.states[board.state.stateToInt()]++;
+    threadStats.checks += res.checkCount > 0;
+    threadStats.doubleChecks += res.checkCount > 1;
+    threadStats.pinned += _popcnt64((res.pinHV | res.pinD) & res.selfOcc);
+    if constexpr (ep) threadStats.epCandidates += _popcnt64((((board.ep & notAfile) >> 1) | ((board.ep & notHfile) << 1)) & self.p);
+    if constexpr (isWhite) {
+        threadStats.castleCandidates += (board.state.wL && !(occ & wLCastleEmpty)) + (board.state.wR && !(occ & wRCastleEmpty));
+    } else {
+        threadStats.castleCandidates += (board.state.bL && !(occ & bLCastleEmpty)) + (board.state.bR && !(occ & bRCastleEmpty));
+    }
+}
+#endif
+
+// check() for the side to move, with the checkMask of a side not in check opened to every square. Computed
+// once per node, it can be shared by every stage generate is called with. Like the generator below it reads
+// only w, b, ep and (for the stats) state of the board, so B is a Board or a view with those members
+template<bool isWhite, bool ep, typename B>
+statusReport status(B &board) {
+    statusReport res;
+    {
+        STATS(PhaseTimer timer(PHASE_STATUS));
+        if constexpr (isWhite) res = check<isWhite, ep>(board.w, board.b);
+        else res = check<isWhite, ep>(board.b, board.w);
+        if (res.checkCount == 0) res.checkMask = ~res.checkMask;
+    }
+    STATS(statNode<isWhite, ep>(board, res));
+    return res;
+}
+
+// stages of generate. CAPTURES are the captures, e.p. and every promotion, QUIETS the rest, ALL both of them.
+// EVASIONS is ALL when the side to move is in check and nothing otherwise. Every stage only emits legal moves,
+// so a consumer can run CAPTURES, then QUIETS only when it has not stopped yet, on the same statusReport
+enum GenType { CAPTURES, QUIETS, EVASIONS, ALL };
+
+// the moves of every piece, without the e.p. captures and castles. Nothing here depends on the ep flag or the
+// castling rights, so it is instantiated per colour, stage and sink instead of once per GameState, and kept
+// out of line so that the generate instantiations share it instead of inlining a copy each
+template<bool isWhite, GenType type, typename Out, typename B>
+[[gnu::noinline]] void generatePieces(B &board, const statusReport &res, Out &out) {
+    constexpr bool captures = type != QUIETS;
+    constexpr bool quiets = type != CAPTURES;
+
+    Pieces self;
+    if constexpr (isWhite) self = board.w;
+    else self = board.b;
+
+    Squares notEnemy = ~res.enemyOcc;
+    Squares notSelf = ~res.selfOcc;
+    Squares occ = res.selfOcc | res.enemyOcc;
+    Squares notpin = ~(res.pinHV | res.pinD);
+
+    // king moves
+    {    
+        Squares kingReachable = kingMoves[res.kingIndex] & ~res.kingBan & ~res.enemySeen & notSelf;
+        if constexpr (quiets) BitLoop(kingReachable & notEnemy) { out.template pieceMove<KING, isWhite>(board, self.k, _blsi_u64(temp)); }
+        if constexpr (captures) BitLoop(kingReachable & res.enemyOcc) { out.template pieceMoveCapture<KING, isWhite>(board, self.k, _blsi_u64(temp)); }
+
+        if (res.checkCount > 1) { // only king can move
+            return;
+        }
+    }
+
+    Squares notselfCheckmask = notSelf & res.checkMask;
+
+    // rook moves
+    {
+        // pinned
+        for (Squares pinnedRooks = self.r & res.pinHV; pinnedRooks; pinnedRooks = _blsr_u64(pinnedRooks)) {
+            Squares current = _blsi_u64(pinnedRooks);
+            uint64_t pieceIndex = _tzcnt_u64(pinnedRooks);
+            Squares atk = slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinHV;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<ROOK, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<ROOK, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+        // not pinned
+        for (Squares unpinnedRooks = self.r & notpin; unpinnedRooks; unpinnedRooks = _blsr_u64(unpinnedRooks)) {
+            Squares current = _blsi_u64(unpinnedRooks);
+            uint64_t pieceIndex = _tzcnt_u64(unpinnedRooks);
+            Squares atk = slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<ROOK, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<ROOK, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+    }
+
+    // bishop moves
+    {
+        // pinned
+        for (Squares pinnedBishops = self.b & res.pinD; pinnedBishops; pinnedBishops = _blsr_u64(pinnedBishops)) {
+            Squares current = _blsi_u64(pinnedBishops);
+            uint64_t pieceIndex = _tzcnt_u64(pinnedBishops);
+            Squares atk = slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinD;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<BISHOP, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<BISHOP, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+        // not pinned
+        for (Squares unpinnedBishops = self.b & notpin; unpinnedBishops; unpinnedBishops = _blsr_u64(unpinnedBishops)) {
+            Squares current = _blsi_u64(unpinnedBishops);
+            uint64_t pieceIndex = _tzcnt_u64(unpinnedBishops);
+            Squares atk = slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<BISHOP, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<BISHOP, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+    }
+
+    // queen moves
+    {
+        for (Squares queensHV = self.q & res.pinHV; queensHV; queensHV = _blsr_u64(queensHV)) {
+            Squares current = _blsi_u64(queensHV);
+            uint64_t pieceIndex = _tzcnt_u64(queensHV);
+            Squares atk = slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinHV;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+        for (Squares queensD = self.q & res.pinD; queensD; queensD = _blsr_u64(queensD)) {
+            Squares current = _blsi_u64(queensD);
+            uint64_t pieceIndex = _tzcnt_u64(queensD);
+            Squares atk = slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinD;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+        for (Squares unpinnedQueens = self.q & notpin; unpinnedQueens; unpinnedQueens = _blsr_u64(unpinnedQueens)) {
+            Squares current = _blsi_u64(unpinnedQueens);
+            uint64_t pieceIndex = _tzcnt_u64(unpinnedQueens);
+            Squares atk = slide(rookMoves[pieceIndex], occ, pieceIndex) | slide(bishopMoves[pieceIndex], occ, pieceIndex);
+            atk &= notselfCheckmask;
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<QUEEN, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+    }
+
+    // knight moves
+    {
+        for (Squares unpinnedKnight = self.n & notpin; unpinnedKnight; unpinnedKnight = _blsr_u64(unpinnedKnight)) {
+            Squares current = _blsi_u64(unpinnedKnight);
+            uint64_t pieceIndex = _tzcnt_u64(unpinnedKnight);
+            Squares atk = knightMoves[pieceIndex] & notselfCheckmask;
+
+            if constexpr (quiets) BitLoop(atk & notEnemy) { out.template pieceMove<KNIGHT, isWhite>(board, current, _blsi_u64(temp)); }
+            if constexpr (captures) BitLoop(atk & res.enemyOcc) { out.template pieceMoveCapture<KNIGHT, isWhite>(board, current, _blsi_u64(temp)); }
+        }
+    }
+
+    // pawns
+    {
+        Squares pawnAdvance;
+        if constexpr (isWhite) pawnAdvance = self.p & ~wPawnLast & ~(occ >> 8); // tirar pabajo 1 fila
+        else pawnAdvance = self.p & ~bPawnLast & ~(occ << 8);
+
+        Squares pawnPush;
+        if constexpr (isWhite) pawnPush = pawnAdvance & wPawnStart & ~(occ >> 16);
+        else pawnPush = pawnAdvance & bPawnStart & ~(occ << 16);
+
+        Squares pawnCaptureL;
+        if constexpr (isWhite) pawnCaptureL = self.p & ~wPawnLast & ((res.enemyOcc & notHfile) >> 7);
+        else pawnCaptureL = self.p & ~bPawnLast & ((res.enemyOcc & notAfile) << 7);
+
+        Squares pawnCaptureR;
+        if constexpr (isWhite) pawnCaptureR = self.p & ~wPawnLast & ((res.enemyOcc & notAfile) >> 9);
+        else pawnCaptureR = self.p & ~bPawnLast & ((res.enemyOcc & notHfile) << 9);
+
+        Squares pawnAdvancePromote;
+        if constexpr (isWhite) pawnAdvancePromote = self.p & wPawnLast & ~(occ >> 8);
+        else pawnAdvancePromote = self.p & bPawnLast & ~(occ << 8);
+
+        Squares pawnCaptureLpromote;
+        if constexpr (isWhite) pawnCaptureLpromote = self.p & wPawnLast & ((res.enemyOcc & notHfile) >> 7);
+        else pawnCaptureLpromote = self.p & bPawnLast & ((res.enemyOcc & notAfile) << 7);
+
+        Squares pawnCaptureRpromote;
+        if constexpr (isWhite) pawnCaptureRpromote = self.p & wPawnLast & ((res.enemyOcc & notAfile) >> 9);
+        else pawnCaptureRpromote = self.p & bPawnLast & ((res.enemyOcc & notHfile) << 9);
+
+        // not pinned
+        if constexpr (quiets) BitLoop(pawnAdvance & notpin) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 8;
+            else final = current >> 8;
+            if (final & notselfCheckmask) out.template pieceMove<PAWN, isWhite>(board, current, final); 
+        }
+        if constexpr (quiets) BitLoop(pawnPush & notpin) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 16;
+            else final = current >> 16;
+            if (final & notselfCheckmask) out.template pawnPush<isWhite>(board, current, final); 
+        }
+        if constexpr (captures) BitLoop(pawnCaptureR & notpin) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 9;
+            else final = current >> 9;
+            if (final & notselfCheckmask) out.template pieceMoveCapture<PAWN, isWhite>(board, current, final); 
+        }
+        if constexpr (captures) BitLoop(pawnCaptureL & notpin) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 7;
+            else final = current >> 7;
+            if (final & notselfCheckmask) out.template pieceMoveCapture<PAWN, isWhite>(board, current, final); 
+        }
+        // pinned
+        if constexpr (quiets) BitLoop(pawnAdvance & res.pinHV) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 8;
+            else final = current >> 8;            
+            if (final & res.pinHV & notselfCheckmask) out.template pieceMove<PAWN, isWhite>(board, current, final); 
+        }
+        if constexpr (quiets) BitLoop(pawnPush & res.pinHV) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 16;
+            else final = current >> 16;
+            if (final & res.pinHV & notselfCheckmask) out.template pawnPush<isWhite>(board, current, final); 
+        }
+        if constexpr (captures) BitLoop(pawnCaptureR & res.pinD) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 9;
+            else final = current >> 9;
+            if (final & res.pinD & notselfCheckmask) out.template pieceMoveCapture<PAWN, isWhite>(board, current, final); 
+        }
+        if constexpr (captures) BitLoop(pawnCaptureL & res.pinD) { 
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 7;
+            else final = current >> 7;
+            if (final & res.pinD & notselfCheckmask) out.template pieceMoveCapture<PAWN, isWhite>(board, current, final); 
+        }
+        // not pinned promotion
+        if constexpr (captures) BitLoop(pawnAdvancePromote & notpin) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 8;
+            else final = current >> 8;
+            if (final & notselfCheckmask) out.template pawnPromote<isWhite>(board, current, final);
+        }
+        if constexpr (captures) BitLoop(pawnCaptureLpromote & notpin) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 7;
+            else final = current >> 7;
+            if (final & notselfCheckmask) out.template pawnPromoteCapture<isWhite>(board, current, final);
+        }
+        if constexpr (captures) BitLoop(pawnCaptureRpromote & notpin) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 9;
+            else final = current >> 9;
+            if (final & notselfCheckmask) out.template pawnPromoteCapture<isWhite>(board, current, final);
+        }
+        // pinned promotion
+        if constexpr (captures) BitLoop(pawnAdvancePromote & res.pinHV) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 8;
+            else final = current >> 8;
+            if (final & res.pinHV & notselfCheckmask) out.template pawnPromote<isWhite>(board, current, final);
+        }
+        if constexpr (captures) BitLoop(pawnCaptureLpromote & res.pinD) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 7;
+            else final = current >> 7;
+            if (final & res.pinD & notselfCheckmask) out.template pawnPromoteCapture<isWhite>(board, current, final);
+        }
+        if constexpr (captures) BitLoop(pawnCaptureRpromote & res.pinD) {
+            Squares current = _blsi_u64(temp); Squares final;
+            if constexpr (isWhite) final = current << 9;
+            else final = current >> 9;
+            if (final & res.pinD & notselfCheckmask) out.template pawnPromoteCapture<isWhite>(board, current, final);
+        }
+    }
+}
+
+// the e.p. captures, only instantiated for the states with an ep pawn
+template<bool isWhite, typename Out, typename B>
+void generateEP(B &board, const statusReport &res, Out &out) {
+    Pieces self;
+    if constexpr (isWhite) self = board.w;
+    else self = board.b;
+    Squares notselfCheckmask = ~res.selfOcc & res.checkMask;
+
+    if (board.ep & ~res.pinD) { // enemy pawn is diagonal pinned (for self), cannot remove it
+
+        Squares enemyPawnBehind;
+        if constexpr (isWhite) enemyPawnBehind = board.ep << 8;
+        else enemyPawnBehind = board.ep >> 8;
+        bool epResolves = (enemyPawnBehind | board.ep) & notselfCheckmask; // a check by the pushed pawn itself is resolved by taking it
+
+        // board.ep is the square of the enemy pawn that pushed
+        if (board.ep & notAfile) { // can capture e.p. to the right
+
+            // pawn must be to the left, not e.p. pinned and not HV pinned
+            Squares pawnToTheLeft = (board.ep >> 1) & self.p & ~res.epPin & ~res.pinHV;
+            // if the pawn is not diagonally pinned
+            if ((pawnToTheLeft & ~res.pinD) && epResolves) out.template pawnEP<isWhite>(board, pawnToTheLeft, enemyPawnBehind);
+            else if ((pawnToTheLeft & res.pinD) && epResolves && (enemyPawnBehind & res.pinD)) out.template pawnEP<isWhite>(board, pawnToTheLeft, enemyPawnBehind);
+        } 
+        if (board.ep & notHfile) { // can capture e.p. to the right
+
+            // pawn must be to the left, not e.p. pinned and not HV pinned
+            Squares pawnToTheRight = (board.ep << 1) & self.p & ~res.epPin & ~res.pinHV;
+            // if the pawn is not diagonally pinned
+            if ((pawnToTheRight & ~res.pinD) && epResolves) out.template pawnEP<isWhite>(board, pawnToTheRight, enemyPawnBehind);
+            else if ((pawnToTheRight & res.pinD) && epResolves && (enemyPawnBehind & res.pinD)) out.template pawnEP<isWhite>(board, pawnToTheRight, enemyPawnBehind);
+        }
+    }
+}
+
+// the castles, only instantiated for the rights of the side to move
+template<bool isWhite, bool wL, bool wR, bool bL, bool bR, typename Out, typename B>
+void generateCastles(B &board, const statusReport &res, Out &out) {
+    Squares occ = res.selfOcc | res.enemyOcc;
+    if constexpr (isWhite) {
+        if constexpr (wL) {
+            if (res.checkCount == 0 && !(occ & wLCastleEmpty) && !(res.enemySeen & wLCastleSeen)) {
+                out.template castleL<isWhite>(board);
+            }
+        }
+        if constexpr (wR) {
+            if (res.checkCount == 0 && !(occ & wRCastleEmpty) && !(res.enemySeen & wRCastleSeen)) {
+                out.template castleR<isWhite>(board);
+            }
+        }
+    } else {
+        if constexpr (bL) {
+            if (res.checkCount == 0 && !(occ & bLCastleEmpty) && !(res.enemySeen & bLCastleSeen)) {
+                out.template castleL<isWhite>(board);
+            }
+        }
+        if constexpr (bR) {
+            if (res.checkCount == 0 && !(occ & bRCastleEmpty) && !(res.enemySeen & bRCastleSeen)) {
+                out.template castleR<isWhite>(board);
+            }
+        }
+    }
+}
+
+// only the e.p. captures and the castles are specialised on the flags of the GameState
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR, GenType type, typename Out, typename B>
+void generate(B &board, const statusReport &res, Out &out) {
+    if constexpr (type == EVASIONS) {
+        if (res.checkCount == 0) return;
+    }
+#if defined(BOARD_STATS)
+    PhaseTimer timer(PHASE_GENERATE);
+    StatSink<Out> sink {out};
+#else
+    Out &sink = out;
+#endif
+    generatePieces<isWhite, type>(board, res, sink);
+    if (res.checkCount > 1) return;
+    if constexpr (ep && type != QUIETS) generateEP<isWhite>(board, res, sink);
+    if constexpr (type != CAPTURES && (isWhite ? wL || wR : bL || bR)) generateCastles<isWhite, wL, wR, bL, bR>(board, res, sink);
+}
+
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR, GenType type = ALL, typename Out>
+void generate(Board &board, Out &out) {
+    generate<isWhite, ep, wL, wR, bL, bR, type>(board, status<isWhite, ep>(board), out);
+}
+
+// writes every legal child of board into out, which must hold at least MAX_MOVES boards, and returns how many were written
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+int generateMoves(Board &board, Board *out) {
+    int count = 0;
+    ChildSink sink {[&](Board &child) { out[count++] = child; }};
+    generate<isWhite, ep, wL, wR, bL, bR>(board, sink);
+    return count;
+}
+
+// same moves as generateMoves, as packed Moves; board.makeMove(out[i]) is the i-th child generateMoves writes
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+int generateMoveList(Board &board, Move *out) {
+    int count = 0;
+    MoveSink sink {[&](Move move) { out[count++] = move; }};
+    generate<isWhite, ep, wL, wR, bL, bR>(board, sink);
+    return count;
+}
+
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+std::vector<Board> generateMoves(Board &board) {
+    std::vector<Board> children;
+    ChildSink sink {[&](Board &child) { children.push_back(child); }};
+    generate<isWhite, ep, wL, wR, bL, bR>(board, sink);
+    return children;
+}
+
+// calls f.template operator()<isWhite, ep, wL, wR, bL, bR>() for the GameState of board: the one runtime
+// dispatch, for callers that run on compile-time states below it
+template<typename F, size_t... I>
+decltype(auto) dispatchState(uint8_t index, F &f, std::index_sequence<I...>) {
+    using Result = decltype(f.template operator()<false, false, false, false, false, false>());
+    static constexpr Result (*table[64])(F&) {
+        [](F &g) -> Result { return g.template operator()<bool(I & 1), bool(I & 2), bool(I & 4), bool(I & 8), bool(I & 16), bool(I & 32)>(); }...
+    };
+    return table[index](f);
+}
+
+template<typename F>
+decltype(auto) withState(Board &board, F &&f) {
+    return dispatchState(board.state.stateToInt(), f, std::make_index_sequence<64>());
+}
+
+// generate for the runtime GameState of board
+template<GenType type = ALL, typename Out>
+void generate(Board &board, Out &out) {
+    withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() { generate<isWhite, ep, wL, wR, bL, bR, type>(board, out); });
+}
+
+template<GenType type = ALL, typename F>
+void forEachChild(Board &board, F &&f) {
+    ChildSink<F&> sink {f};
+    generate<type>(board, sink);
+}
+
+template<GenType type = ALL, typename F>
+void forEachMove(Board &board, F &&f) {
+    MoveSink<F&> sink {f};
+    generate<type>(board, sink);
+}
+
+// the moves of every piece for countMoves, split off like generatePieces so it is instantiated per colour
+template<bool isWhite, typename B>
+[[gnu::noinline]] int countPieces(B &board, const statusReport &res) {
+    Pieces self;
+    if constexpr (isWhite) self = board.w;
+    else self = board.b;
+
+    Squares notSelf = ~res.selfOcc;
+    Squares occ = res.selfOcc | res.enemyOcc;
+    Squares notpin = ~(res.pinHV | res.pinD);
+
+    int count = _popcnt64(kingMoves[res.kingIndex] & ~res.kingBan & ~res.enemySeen & notSelf);
+    if (res.checkCount > 1) return count;
+
+    Squares notselfCheckmask = notSelf & res.checkMask;
+
+    // sliders, a pinned piece may only move along the pin
+    BitLoop(self.r & res.pinHV) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinHV);
+    }
+    BitLoop(self.r & notpin) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask);
+    }
+    BitLoop(self.b & res.pinD) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinD);
+    }
+    BitLoop(self.b & notpin) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask);
+    }
+    BitLoop(self.q & res.pinHV) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(rookMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinHV);
+    }
+    BitLoop(self.q & res.pinD) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64(slide(bishopMoves[pieceIndex], occ, pieceIndex) & notselfCheckmask & res.pinD);
+    }
+    BitLoop(self.q & notpin) {
+        uint64_t pieceIndex = _tzcnt_u64(temp);
+        count += _popcnt64((slide(rookMoves[pieceIndex], occ, pieceIndex) | slide(bishopMoves[pieceIndex], occ, pieceIndex)) & notselfCheckmask);
+    }
+    BitLoop(self.n & notpin) {
+        count += _popcnt64(knightMoves[_tzcnt_u64(temp)] & notselfCheckmask);
+    }
+
+    // pawns, counted set-wise on the destination squares
+    {
+        Squares pawnAdvance, pawnPush, pawnCaptureL, pawnCaptureR, pawnAdvancePromote, pawnCaptureLpromote, pawnCaptureRpromote;
+        Squares advance, push, captureL, captureR, advancePromote, captureLpromote, captureRpromote;
+        if constexpr (isWhite) {
+            pawnAdvance = self.p & ~wPawnLast & ~(occ >> 8);
+            pawnPush = pawnAdvance & wPawnStart & ~(occ >> 16);
+            pawnCaptureL = self.p & ~wPawnLast & ((res.enemyOcc & notHfile) >> 7);
+            pawnCaptureR = self.p & ~wPawnLast & ((res.enemyOcc & notAfile) >> 9);
+            pawnAdvancePromote = self.p & wPawnLast & ~(occ >> 8);
+            pawnCaptureLpromote = self.p & wPawnLast & ((res.enemyOcc & notHfile) >> 7);
+            pawnCaptureRpromote = self.p & wPawnLast & ((res.enemyOcc & notAfile) >> 9);
+
+            advance = ((pawnAdvance & notpin) << 8) | ((pawnAdvance & res.pinHV) << 8 & res.pinHV);
+            push = ((pawnPush & notpin) << 16) | ((pawnPush & res.pinHV) << 16 & res.pinHV);
+            captureL = ((pawnCaptureL & notpin) << 7) | ((pawnCaptureL & res.pinD) << 7 & res.pinD);
+            captureR = ((pawnCaptureR & notpin) << 9) | ((pawnCaptureR & res.pinD) << 9 & res.pinD);
+            advancePromote = ((pawnAdvancePromote & notpin) << 8) | ((pawnAdvancePromote & res.pinHV) << 8 & res.pinHV);
+            captureLpromote = ((pawnCaptureLpromote & notpin) << 7) | ((pawnCaptureLpromote & res.pinD) << 7 & res.pinD);
+            captureRpromote = ((pawnCaptureRpromote & notpin) << 9) | ((pawnCaptureRpromote & res.pinD) << 9 & res.pinD);
+        } else {
+            pawnAdvance = self.p & ~bPawnLast & ~(occ << 8);
+            pawnPush = pawnAdvance & bPawnStart & ~(occ << 16);
+            pawnCaptureL = self.p & ~bPawnLast & ((res.enemyOcc & notAfile) << 7);
+            pawnCaptureR = self.p & ~bPawnLast & ((res.enemyOcc & notHfile) << 9);
+            pawnAdvancePromote = self.p & bPawnLast & ~(occ << 8);
+            pawnCaptureLpromote = self.p & bPawnLast & ((res.enemyOcc & notAfile) << 7);
+            pawnCaptureRpromote = self.p & bPawnLast & ((res.enemyOcc & notHfile) << 9);
+
+            advance = ((pawnAdvance & notpin) >> 8) | ((pawnAdvance & res.pinHV) >> 8 & res.pinHV);
+            push = ((pawnPush & notpin) >> 16) | ((pawnPush & res.pinHV) >> 16 & res.pinHV);
+            captureL = ((pawnCaptureL & notpin) >> 7) | ((pawnCaptureL & res.pinD) >> 7 & res.pinD);
+            captureR = ((pawnCaptureR & notpin) >> 9) | ((pawnCaptureR & res.pinD) >> 9 & res.pinD);
+            advancePromote = ((pawnAdvancePromote & notpin) >> 8) | ((pawnAdvancePromote & res.pinHV) >> 8 & res.pinHV);
+            captureLpromote = ((pawnCaptureLpromote & notpin) >> 7) | ((pawnCaptureLpromote & res.pinD) >> 7 & res.pinD);
+            captureRpromote = ((pawnCaptureRpromote & notpin) >> 9) | ((pawnCaptureRpromote & res.pinD) >> 9 & res.pinD);
+        }
+        count += _popcnt64(advance & notselfCheckmask) + _popcnt64(push & notselfCheckmask);
+        count += _popcnt64(captureL & notselfCheckmask) + _popcnt64(captureR & notselfCheckmask);
+        count += 4 * (_popcnt64(advancePromote & notselfCheckmask) + _popcnt64(captureLpromote & notselfCheckmask) + _popcnt64(captureRpromote & notselfCheckmask));
+    }
+
+    return count;
+}
+
+// number of legal moves, same masks as generate but only popcounting the reachable squares per piece class
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR, typename B>
+int countMoves(B &board, const statusReport &res) {
+    STATS(PhaseTimer timer(PHASE_GENERATE));
+    int count = countPieces<isWhite>(board, res);
+    if (res.checkCount > 1) return count;
+
+    Squares occ = res.selfOcc | res.enemyOcc;
+
+    // enpassant
+    if constexpr (ep) {
+        Squares self = isWhite ? board.w.p : board.b.p;
+        Squares notselfCheckmask = ~res.selfOcc & res.checkMask;
+        if (board.ep & ~res.pinD) {
+            Squares enemyPawnBehind;
+            if constexpr (isWhite) enemyPawnBehind = board.ep << 8;
+            else enemyPawnBehind = board.ep >> 8;
+            bool epResolves = (enemyPawnBehind | board.ep) & notselfCheckmask;
+
+            if (board.ep & notAfile) {
+                Squares pawnToTheLeft = (board.ep >> 1) & self & ~res.epPin & ~res.pinHV;
+                if ((pawnToTheLeft & ~res.pinD) && epResolves) count++;
+                else if ((pawnToTheLeft & res.pinD) && epResolves && (enemyPawnBehind & res.pinD)) count++;
+            }
+            if (board.ep & notHfile) {
+                Squares pawnToTheRight = (board.ep << 1) & self & ~res.epPin & ~res.pinHV;
+                if ((pawnToTheRight & ~res.pinD) && epResolves) count++;
+                else if ((pawnToTheRight & res.pinD) && epResolves && (enemyPawnBehind & res.pinD)) count++;
+            }
+        }
+    }
+
+    // castles
+    if constexpr (isWhite) {
+        if constexpr (wL) count += res.checkCount == 0 && !(occ & wLCastleEmpty) && !(res.enemySeen & wLCastleSeen);
+        if constexpr (wR) count += res.checkCount == 0 && !(occ & wRCastleEmpty) && !(res.enemySeen & wRCastleSeen);
+    } else {
+        if constexpr (bL) count += res.checkCount == 0 && !(occ & bLCastleEmpty) && !(res.enemySeen & bLCastleSeen);
+        if constexpr (bR) count += res.checkCount == 0 && !(occ & bRCastleEmpty) && !(res.enemySeen & bRCastleSeen);
+    }
+
+    return count;
+}
+
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+int countMoves(Board &board) {
+    return countMoves<isWhite, ep, wL, wR, bL, bR>(board, status<isWhite, ep>(board));
+}
+
+// whether move is encoded as the generator encodes the moves of board, ignoring the safety of the king: a piece
+// of the side to move stands on from and can reach to, the CAPTURE flag is set exactly when to holds an enemy
+// piece, a pawn promotes exactly when it reaches the last rank, and a castle has its right and its empty squares
+template<bool isWhite>
+bool pseudoLegal(const Board &board, Move move) {
+    Pieces self, enemy;
+    if constexpr (isWhite) { self = board.w; enemy = board.b; }
+    else { self = board.b; enemy = board.w; }
+
+    int from = move.from(), to = move.to(), piece = move.piece(), promotion = move.promotion();
+    uint32_t flags = move.data & (Move::CAPTURE | Move::EP | Move::CASTLE | Move::PUSH);
+    if (move.data >> 22 || piece > PAWN) return false;
+
+    Squares fromBit = 1ULL << from, toBit = 1ULL << to;
+    Squares selfOcc = self.occupied(), enemyOcc = enemy.occupied();
+    Squares occ = selfOcc | enemyOcc;
+    const Squares pieces[6] {self.k, self.q, self.r, self.b, self.n, self.p};
+    if (!(pieces[piece] & fromBit) || (toBit & selfOcc)) return false;
+
+    if (flags & Move::CASTLE) {
+        const GameState &state = board.state;
+        if constexpr (isWhite) {
+            if (move == Move(4, 2, KING, Move::CASTLE)) return state.wL && !(occ & wLCastleEmpty);
+            if (move == Move(4, 6, KING, Move::CASTLE)) return state.wR && !(occ & wRCastleEmpty);
+        } else {
+            if (move == Move(60, 58, KING, Move::CASTLE)) return state.bL && !(occ & bLCastleEmpty);
+            if (move == Move(60, 62, KING, Move::CASTLE)) return state.bR && !(occ & bRCastleEmpty);
+        }
+        return false;
+    }
+    if (flags & Move::EP) { // to is behind the pawn that just pushed, from next to it
+        Squares behind = isWhite ? board.ep << 8 : board.ep >> 8;
+        Squares beside = (board.ep & notAfile) >> 1 | (board.ep & notHfile) << 1;
+        return board.state.ep && move == Move(from, to, PAWN, Move::CAPTURE | Move::EP) && toBit == behind && (fromBit & beside);
+    }
+    if (bool(toBit & enemyOcc) != bool(flags & Move::CAPTURE)) return false;
+
+    if (piece != PAWN) {
+        if (promotion || flags & Move::PUSH) return false;
+        switch (piece) {
+            case KING: return kingMoves[from] & toBit;
+            case QUEEN: return (rookSlide(occ, from) | bishopSlide(occ, from)) & toBit;
+            case ROOK: return rookSlide(occ, from) & toBit;
+            case BISHOP: return bishopSlide(occ, from) & toBit;
+            default: return knightMoves[from] & toBit;
+        }
+    }
+
+    bool promotes = fromBit & (isWhite ? wPawnLast : bPawnLast);
+    if (promotes ? promotion < QUEEN || promotion > KNIGHT : promotion != 0) return false;
+    Squares step = isWhite ? fromBit << 8 : fromBit >> 8;
+    if (flags & Move::PUSH) {
+        Squares push = isWhite ? fromBit << 16 : fromBit >> 16;
+        return flags == Move::PUSH && (fromBit & (isWhite ? wPawnStart : bPawnStart)) && toBit == push && !((step | push) & occ);
+    }
+    if (flags & Move::CAPTURE) {
+        Squares attacks;
+        if constexpr (isWhite) attacks = (fromBit & notAfile) << 7 | (fromBit & notHfile) << 9;
+        else attacks = (fromBit & notAfile) >> 9 | (fromBit & notHfile) >> 7;
+        return attacks & toBit;
+    }
+    return toBit == step && !(step & occ);
+}
+
+// whether a pseudoLegal move is legal, from the masks of status(): the same tests generate applies to each
+// kind of move, on the one from and to square instead of on every piece
+template<bool isWhite>
+bool isLegal(const Board &board, const statusReport &res, Move move) {
+    int from = move.from(), to = move.to(), piece = move.piece();
+    Squares fromBit = 1ULL << from, toBit = 1ULL << to;
+
+    if (piece == KING) {
+        if (!move.isCastle()) return !(toBit & (res.kingBan | res.enemySeen));
+        Squares crossed;
+        if constexpr (isWhite) crossed = to < from ? wLCastleSeen : wRCastleSeen;
+        else crossed = to < from ? bLCastleSeen : bRCastleSeen;
+        return res.checkCount == 0 && !(res.enemySeen & crossed);
+    }
+    if (res.checkCount > 1) return false;
+
+    if (move.isEP()) {
+        if ((board.ep & res.pinD) || (fromBit & (res.epPin | res.pinHV))) return false;
+        if (!((toBit | board.ep) & res.checkMask)) return false; // a check by the pushed pawn itself is resolved by taking it
+        return !(fromBit & res.pinD) || (toBit & res.pinD);
+    }
+    if (!(toBit & res.checkMask)) return false;
+
+    // a pinned piece may only move along the pin, a queen only in the direction of its pin
+    if (fromBit & res.pinHV) {
+        bool along = piece == ROOK || (piece == QUEEN && (rookMoves[from] & toBit)) || (piece == PAWN && !move.isCapture());
+        return along && (toBit & res.pinHV);
+    }
+    if (fromBit & res.pinD) {
+        bool along = piece == BISHOP || (piece == QUEEN && (bishopMoves[from] & toBit)) || (piece == PAWN && move.isCapture());
+        return along && (toBit & res.pinD);
+    }
+    return true;
+}
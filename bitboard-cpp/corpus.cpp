@@ -0,0 +1,129 @@
+#include "corpus.h"
+#include "attacks.h"
+#include "quad.h"
+#include "pgn.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+std::vector<EpdEntry> readEPD(const std::string &path) {
+    std::vector<EpdEntry> entries;
+    std::ifstream file(path);
+    std::string line;
+    while (getline(file, line)) {
+        size_t split = line.find(';');
+        if (line.empty() || line[0] == '#' || split == std::string::npos) continue;
+
+        EpdEntry entry;
+        entry.fen = line.substr(0, line.find_last_not_of(' ', split - 1) + 1);
+
+        std::istringstream fields(line.substr(split));
+        std::string field;
+        while (getline(fields, field, ';')) {
+            int depth;
+            unsigned long long nodes;
+            if (sscanf(field.c_str(), " D%d %llu", &depth, &nodes) == 2) entry.expected.push_back({depth, nodes});
+        }
+        if (!entry.expected.empty()) entries.push_back(entry);
+    }
+    return entries;
+}
+
+namespace {
+
+void collectTree(int depth, Board &board, std::vector<Board> &out) {
+    out.push_back(board);
+    if (depth > 0) forEachChild(board, [&](Board &child) { collectTree(depth - 1, child, out); });
+}
+
+uint64_t xorshift(uint64_t &seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+} // namespace
+
+std::vector<Board> collectNodes(const std::vector<EpdEntry> &entries, int depth) {
+    std::vector<Board> nodes;
+    for (auto &entry : entries) {
+        Board board = parseFEN(entry.fen);
+        collectTree(depth, board, nodes);
+    }
+    return nodes;
+}
+
+FenClocks nodeClocks(size_t i) { return {uint16_t(i % 100), uint16_t(1 + i % 300)}; }
+
+bool sameBoard(const Board &a, const Board &b) {
+    GameState sa = a.state, sb = b.state;
+    return !memcmp(&a.w, &b.w, sizeof(Pieces)) && !memcmp(&a.b, &b.b, sizeof(Pieces)) && a.ep == b.ep && a.hash == b.hash
+        && sa.stateToInt() == sb.stateToInt();
+}
+
+uint64_t runPerft(const std::string &mode, int depth, Board &board, WorkStealingPool *pool, int splitDepth) {
+    if (pool) return parallelPerft(depth, board, *pool, splitDepth);
+    if (mode == "dispatch") return perftDispatch(depth, board);
+    if (mode == "scratch") return attackPerft(depth, board, SCRATCH);
+    if (mode == "attacks") return attackPerft(depth, board, ATTACKS);
+    if (mode == "fill") return attackPerft(depth, board, FILL);
+    if (mode == "quad") return quadPerft(depth, board);
+    return perft(depth, board);
+}
+
+bool attackWalks(const std::string &mode) { return mode == "scratch" || mode == "attacks" || mode == "fill"; }
+
+QuiescenceCounts firstWalk(const std::string &mode, int depth, int plies, Board &board) {
+    if (!attackWalks(mode)) return quiescence(depth, plies, board, true);
+    return attackQuiescence(depth, plies, board, mode == "fill" ? FILL : ATTACKS);
+}
+
+QuiescenceCounts secondWalk(const std::string &mode, int depth, int plies, Board &board) {
+    return attackWalks(mode) ? attackQuiescence(depth, plies, board, SCRATCH) : quiescence(depth, plies, board, false);
+}
+
+std::string randomGame(Board board, uint64_t &seed, Board &final) {
+    std::string game = "[Event \"bench\"]\n[FEN \"" + toFEN(board) + "\"]\n\n";
+    Move moves[MAX_MOVES];
+    for (int ply = 0; ply < 160; ply++) {
+        int count = generateMoveList(board, moves);
+        if (!count) break;
+        Move move = moves[xorshift(seed) % count];
+        if (board.state.isWhite) game += std::to_string(ply / 2 + 1) + ". ";
+        else if (!ply) game += "1... ";
+        game += moveToSAN(board, move);
+        game += ply % 17 == 5 ? " {a comment} " : ply % 23 == 7 ? " $1 (" + moveToSAN(board, moves[0]) + " {inside}) " : " ";
+        if (ply % 12 == 11) game += '\n';
+        board = board.makeMove(move);
+    }
+    final = board;
+    return game + "*\n\n";
+}
+
+std::vector<Candidate> moveCandidates(std::vector<Board> &nodes) {
+    size_t n = nodes.size();
+    std::vector<std::vector<Move>> lists(n);
+    for (size_t i = 0; i < n; i++) {
+        Move moves[MAX_MOVES];
+        lists[i].assign(moves, moves + generateMoveList(nodes[i], moves));
+    }
+
+    std::vector<Candidate> candidates;
+    uint64_t seed = 0x2545f4914f6cdd1dULL;
+    for (size_t i = 0; i < n; i++) {
+        auto legal = [&](Move move) { return std::find(lists[i].begin(), lists[i].end(), move) != lists[i].end(); };
+        for (Move move : lists[i]) candidates.push_back({uint32_t(i), move, true});
+        for (Move move : lists[(i + 1) % n]) candidates.push_back({uint32_t(i), move, legal(move)});
+        for (int j = 0; j < 4; j++) {
+            Move move;
+            move.data = xorshift(seed) & ((1 << 22) - 1);
+            if (j % 2 && !lists[i].empty()) move.data = lists[i][xorshift(seed) % lists[i].size()].data ^ 1 << xorshift(seed) % 22; // one bit off a legal move
+            candidates.push_back({uint32_t(i), move, legal(move)});
+        }
+    }
+    return candidates;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "bitboard.h"
+#include "perft.h"
+#include "fen.h"
+#include "fill.h"
+#include "parallel.h"
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// the EPD corpus and the fixtures bench and tests build from it
+
+struct EpdEntry {
+    std::string fen;
+    std::vector<std::pair<int, uint64_t>> expected; // (depth, nodes)
+};
+
+// every line of the file with expected counts, "FEN ;D1 20 ;D2 400 ..."; empty when it cannot be read
+std::vector<EpdEntry> readEPD(const std::string &path);
+
+// every node of the perft trees of the entries down to depth, roots included
+std::vector<Board> collectNodes(const std::vector<EpdEntry> &entries, int depth);
+
+// the clocks the round trips give node i
+FenClocks nodeClocks(size_t i);
+
+bool sameBoard(const Board &a, const Board &b);
+
+// perft with the walk of -m: template, dispatch, scratch, attacks, fill or quad. With a pool the template walk
+// runs through parallelPerft, split splitDepth plies below the root
+uint64_t runPerft(const std::string &mode, int depth, Board &board, WorkStealingPool *pool = nullptr, int splitDepth = 2);
+
+// the two quiescence walks of a mode, the first one is the new path: staged against ALL, or with scratch,
+// attacks or fill that source against check() on the staged walk
+bool attackWalks(const std::string &mode);
+QuiescenceCounts firstWalk(const std::string &mode, int depth, int plies, Board &board);
+QuiescenceCounts secondWalk(const std::string &mode, int depth, int plies, Board &board);
+
+// 0 is check(), 1 checkFill() with the scalar fill and 2 with the vector one
+template<int kind>
+statusReport statusOf(Board &board) {
+    return withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        const Pieces &self = isWhite ? board.w : board.b;
+        const Pieces &enemy = isWhite ? board.b : board.w;
+        if constexpr (kind == 0) return check<isWhite, ep>(self, enemy);
+        else if constexpr (kind == 1) return checkFill<isWhite, ep, false>(self, enemy);
+        else return checkFill<isWhite, ep>(self, enemy);
+    });
+}
+
+// a game of random legal moves from board, up to 160 plies, as PGN with a comment, a NAG and a variation now
+// and then for the reader to skip. final is the last position
+std::string randomGame(Board board, uint64_t &seed, Board &final);
+
+// a move to validate on nodes[node], legal when it is in the list of the generator
+struct Candidate {
+    uint32_t node;
+    Move move;
+    bool legal;
+};
+
+// every legal move of every node, the moves of the next node and random encodings
+std::vector<Candidate> moveCandidates(std::vector<Board> &nodes);
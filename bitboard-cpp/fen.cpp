@@ -0,0 +1,219 @@
+#include "fen.h"
+#include "bitboard.h"
+
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <iostream>
+
+namespace {
+
+const char LETTERS[] = "KQRBNPkqrbnp"; // indexed by piece, then by piece + 6 for black
+
+// 1 + the Zobrist slot of a FEN letter, colour * 6 + piece with colour 1 for white as in zobrist.piece, 0 for
+// anything else
+constexpr std::array<uint8_t, 256> letterSlots = [] {
+    std::array<uint8_t, 256> slots {};
+    for (int i = 0; i < 12; i++) slots[(uint8_t) LETTERS[i]] = 1 + (i < 6 ? 6 + i : i - 6);
+    return slots;
+}();
+
+bool fieldEnd(std::string_view fen, size_t i) { return i == fen.size() || fen[i] == ' ' || fen[i] == ';'; }
+
+// skips the spaces before a field, false when the string ends first
+bool nextField(std::string_view fen, size_t &i) {
+    size_t start = i;
+    while (i < fen.size() && fen[i] == ' ') i++;
+    if (i == start || i == fen.size() || fen[i] == ';') {
+        i = start;
+        return false;
+    }
+    return true;
+}
+
+bool readClock(std::string_view fen, size_t &i, uint16_t &value) {
+    unsigned res = 0;
+    size_t start = i;
+    while (i < fen.size() && fen[i] >= '0' && fen[i] <= '9' && i - start < 5) res = res * 10 + (fen[i++] - '0');
+    if (i == start || res > 65535 || !fieldEnd(fen, i)) return false;
+    value = res;
+    return true;
+}
+
+} // namespace
+
+FenStatus readFEN(std::string_view fen, Board &board, FenClocks *clocks) {
+    Squares pieces[2][6] {}; // [white][piece]
+    uint64_t hash = 0; // piece keys, added as the pieces are placed
+    size_t i = 0;
+
+    // placement, from a8 to h1
+    int rank = 7, file = 0;
+    for (; i < fen.size() && fen[i] != ' '; i++) {
+        char c = fen[i];
+        if (c >= '1' && c <= '8') {
+            file += c - '0';
+            if (file > 8) return {FEN_PLACEMENT, i};
+        } else if (c == '/') {
+            if (file != 8 || rank == 0) return {FEN_PLACEMENT, i};
+            rank--;
+            file = 0;
+        } else {
+            unsigned slot = letterSlots[(uint8_t) c] - 1;
+            if (slot >= 12 || file == 8) return {FEN_PLACEMENT, i};
+            unsigned square = rank * 8 + file++;
+            pieces[slot >= 6][slot % 6] |= 1ULL << square;
+            hash ^= zobrist.piece[slot >= 6][slot % 6][square];
+        }
+    }
+    if (rank != 0 || file != 8) return {FEN_PLACEMENT, i};
+    if (_popcnt64(pieces[1][KING]) != 1 || _popcnt64(pieces[0][KING]) != 1) return {FEN_KINGS, 0};
+    if ((pieces[1][PAWN] | pieces[0][PAWN]) & 0xff000000000000ffULL) return {FEN_PAWNS, 0};
+    Pieces white {pieces[1][KING], pieces[1][QUEEN], pieces[1][ROOK], pieces[1][BISHOP], pieces[1][KNIGHT], pieces[1][PAWN]};
+    Pieces black {pieces[0][KING], pieces[0][QUEEN], pieces[0][ROOK], pieces[0][BISHOP], pieces[0][KNIGHT], pieces[0][PAWN]};
+
+    // side to move
+    if (!nextField(fen, i) || (fen[i] != 'w' && fen[i] != 'b') || !fieldEnd(fen, i + 1)) return {FEN_SIDE, i};
+    bool isWhite = fen[i++] == 'w';
+
+    // castling, L is the queenside (a-file) rook and R the kingside one
+    bool wL = false, wR = false, bL = false, bR = false;
+    if (nextField(fen, i)) {
+        if (fen[i] == '-') i++;
+        else {
+            for (; !fieldEnd(fen, i); i++) {
+                bool *right = fen[i] == 'K' ? &wR : fen[i] == 'Q' ? &wL : fen[i] == 'k' ? &bR : fen[i] == 'q' ? &bL : nullptr;
+                if (!right || *right) return {FEN_CASTLING, i};
+                *right = true;
+            }
+        }
+        if (!fieldEnd(fen, i)) return {FEN_CASTLING, i};
+    }
+    // a right is only kept while king and rook are still on their starting squares
+    wL = wL && (white.k & 0x10ULL) && (white.r & wLrookStart);
+    wR = wR && (white.k & 0x10ULL) && (white.r & wRrookStart);
+    bL = bL && (black.k & 0x1000000000000000ULL) && (black.r & bLrookStart);
+    bR = bR && (black.k & 0x1000000000000000ULL) && (black.r & bRrookStart);
+
+    // e.p. target square, stored as the square of the pawn that just pushed. It is dropped unless that pawn is
+    // there and the target square is empty
+    Squares enp = 0;
+    if (nextField(fen, i)) {
+        if (fen[i] == '-') i++;
+        else {
+            if (fen[i] < 'a' || fen[i] > 'h' || i + 1 == fen.size() || fen[i + 1] != (isWhite ? '6' : '3')) return {FEN_EP, i};
+            Squares pawn = 1ULL << ((isWhite ? 4 : 3) * 8 + fen[i] - 'a');
+            Squares behind = isWhite ? pawn << 8 : pawn >> 8;
+            if (((isWhite ? black.p : white.p) & pawn) && !(behind & (white.occupied() | black.occupied()))) enp = pawn;
+            i += 2;
+        }
+        if (!fieldEnd(fen, i)) return {FEN_EP, i};
+    }
+
+    // halfmove and fullmove clocks
+    FenClocks read;
+    size_t field = i;
+    if (nextField(fen, field) && fen[field] >= '0' && fen[field] <= '9') {
+        i = field;
+        if (!readClock(fen, i, read.halfmove)) return {FEN_CLOCK, field};
+        field = i;
+        if (nextField(fen, field) && fen[field] >= '0' && fen[field] <= '9') {
+            i = field;
+            if (!readClock(fen, i, read.fullmove) || !read.fullmove) return {FEN_CLOCK, field};
+        }
+    }
+
+    GameState state {enp != 0, wL, wR, bL, bR, isWhite};
+    hash ^= (isWhite ? zobrist.side : 0) ^ zobrist.castle[state.castleToInt()] ^ zobrist.ep[_tzcnt_u64(enp)];
+    Board parsed {white, black, enp, state, hash};
+
+    // the side that just moved cannot have left its king in check, the generator assumes it did not
+    if ((isWhite ? status<false, false>(parsed) : status<true, false>(parsed)).checkCount) return {FEN_CHECK, 0};
+
+    board = parsed;
+    assert(board.hash == board.computeHash());
+    board.fillMailbox();
+    if (clocks) *clocks = read;
+    return {FEN_OK, i};
+}
+
+size_t writeFEN(const Board &board, char *out, FenClocks clocks) {
+    char squares[64] {};
+    const Squares pieces[12] {board.w.k, board.w.q, board.w.r, board.w.b, board.w.n, board.w.p,
+                              board.b.k, board.b.q, board.b.r, board.b.b, board.b.n, board.b.p};
+    for (int i = 0; i < 12; i++) {
+        for (Squares temp = pieces[i]; temp; temp = _blsr_u64(temp)) squares[_tzcnt_u64(temp)] = LETTERS[i];
+    }
+
+    char *p = out;
+    for (int rank = 7; rank >= 0; rank--) {
+        int empty = 0;
+        for (int file = 0; file < 8; file++) {
+            char c = squares[rank * 8 + file];
+            if (!c) {
+                empty++;
+                continue;
+            }
+            if (empty) *p++ = '0' + empty;
+            empty = 0;
+            *p++ = c;
+        }
+        if (empty) *p++ = '0' + empty;
+        if (rank) *p++ = '/';
+    }
+
+    *p++ = ' ';
+    *p++ = board.state.isWhite ? 'w' : 'b';
+    *p++ = ' ';
+    const GameState &state = board.state;
+    if (!(state.wL || state.wR || state.bL || state.bR)) *p++ = '-';
+    if (state.wR) *p++ = 'K';
+    if (state.wL) *p++ = 'Q';
+    if (state.bR) *p++ = 'k';
+    if (state.bL) *p++ = 'q';
+
+    *p++ = ' ';
+    if (state.ep) {
+        uint64_t pawn = _tzcnt_u64(board.ep);
+        *p++ = 'a' + pawn % 8;
+        *p++ = state.isWhite ? '6' : '3';
+    } else {
+        *p++ = '-';
+    }
+
+    *p++ = ' ';
+    p = std::to_chars(p, out + MAX_FEN, clocks.halfmove).ptr;
+    *p++ = ' ';
+    p = std::to_chars(p, out + MAX_FEN, clocks.fullmove).ptr;
+    return p - out;
+}
+
+std::string toFEN(const Board &board, FenClocks clocks) {
+    char buffer[MAX_FEN];
+    return std::string(buffer, writeFEN(board, buffer, clocks));
+}
+
+const char *fenErrorName(FenError error) {
+    switch (error) {
+    case FEN_OK: return "ok";
+    case FEN_PLACEMENT: return "placement";
+    case FEN_KINGS: return "kings";
+    case FEN_PAWNS: return "pawns";
+    case FEN_SIDE: return "side";
+    case FEN_CASTLING: return "castling";
+    case FEN_EP: return "ep";
+    case FEN_CLOCK: return "clock";
+    case FEN_CHECK: return "check";
+    }
+    return "unknown";
+}
+
+Board parseFEN(const std::string& fen) {
+    Board board;
+    FenStatus status = readFEN(fen, board);
+    if (status.error != FEN_OK) {
+        std::cerr << "Error: bad FEN (" << fenErrorName(status.error) << " at " << status.offset << "): " << fen << std::endl;
+        readFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", board);
+    }
+    return board;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "base.h"
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+// why readFEN stopped, at FenStatus::offset
+enum FenError {
+    FEN_OK,
+    FEN_PLACEMENT, // unknown piece letter, a rank without exactly 8 squares, or not 8 ranks
+    FEN_KINGS, // not exactly one king per side
+    FEN_PAWNS, // a pawn on the first or the last rank
+    FEN_SIDE, // side to move other than w or b
+    FEN_CASTLING, // not - or KQkq letters, each at most once
+    FEN_EP, // not - or a square on the rank the side to move captures e.p. to
+    FEN_CLOCK, // halfmove or fullmove that is not a number up to 65535, or fullmove 0
+    FEN_CHECK, // the side not to move is in check
+};
+
+struct FenStatus {
+    FenError error;
+    size_t offset; // of the error, or on success the length of the FEN read, where EPD operations start
+};
+
+// the move counters of a FEN, which Board does not carry
+struct FenClocks {
+    uint16_t halfmove = 0;
+    uint16_t fullmove = 1;
+};
+
+constexpr size_t MAX_FEN = 128; // longest FEN writeFEN writes, clocks included
+
+// reads fen into board without allocating. The placement and the side to move are required; castling, e.p.
+// and the two clocks may be missing at the end, and the clocks are absent in EPD. A castling right is dropped
+// when its king or rook is not on its square, and the e.p. square when the pawn that pushed is not there or
+// the square is occupied. board is only written on success
+FenStatus readFEN(std::string_view fen, Board &board, FenClocks *clocks = nullptr);
+
+// writes the FEN of board into out, which holds at least MAX_FEN chars, and returns its length; out is not
+// terminated. The e.p. square is written whenever state.ep is set, so readFEN gives back the same Board
+size_t writeFEN(const Board &board, char *out, FenClocks clocks = {});
+
+std::string toFEN(const Board &board, FenClocks clocks = {});
+
+const char *fenErrorName(FenError error);
+
+// readFEN for trusted input: a FEN with an error is reported on stderr and gives the initial position
+Board parseFEN(const std::string& fen);
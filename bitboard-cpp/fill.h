@@ -0,0 +1,252 @@
+#pragma once
+
+#include "bitboard.h"
+
+#include <bit>
+#include <cstdint>
+#include <immintrin.h>
+
+// set-wise slider attacks: a Kogge-Stone occluded fill floods every generator of a direction through the
+// propagator squares in three shift steps, so the attacks of all enemy rooks, bishops and queens take the
+// same instructions whatever the number of pieces. The eight directions are lanes, in the order of lookup.h
+// (N, S, E, W, NE, SW, NW, SE, opposite = d^1). Backends, selected at compile time:
+//   FILL_AVX512 - the eight lanes in one vector, as rotates (default when compiled with AVX-512F)
+//   FILL_AVX2   - two vectors of four lanes, shifting left for N, E, NE, NW and right for the rest
+//   FILL_SCALAR - one direction at a time
+#if !defined(FILL_AVX512) && !defined(FILL_AVX2) && !defined(FILL_SCALAR)
+#if defined(__AVX512F__)
+#define FILL_AVX512
+#elif defined(__AVX2__)
+#define FILL_AVX2
+#else
+#define FILL_SCALAR
+#endif
+#endif
+
+#if defined(FILL_AVX512)
+inline constexpr const char *fillBackend = "avx512";
+#elif defined(FILL_AVX2)
+inline constexpr const char *fillBackend = "avx2";
+#else
+inline constexpr const char *fillBackend = "scalar";
+#endif
+
+#if defined(FILL_AVX512) && defined(__GNUC__) && !defined(__clang__)
+// GCC 12 takes the undefined source operand of the AVX-512 rotate and shuffle intrinsics for an uninitialized
+// variable once they are inlined (GCC bug 105593)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// rotate left amount of a one square step per direction
+alignas(64) inline constexpr uint64_t fillRotate[8] {8, 56, 1, 63, 9, 55, 7, 57};
+// squares a one square step may land on, a rotate wraps to the other edge everywhere else
+alignas(64) inline constexpr Squares fillWrap[8] {
+    0xffffffffffffff00ULL, 0x00ffffffffffffffULL, notAfile, notHfile,
+    notAfile & 0xffffffffffffff00ULL, notHfile & 0x00ffffffffffffffULL, notHfile & 0xffffffffffffff00ULL, notAfile & 0x00ffffffffffffffULL,
+};
+
+// out[d] = squares attacked in direction d by the pieces of gen[d], sliding through the squares of pro[d]
+inline void fillScalar(const Squares *gen, const Squares *pro, Squares *out) {
+    for (int d = 0; d < 8; d++) {
+        int r = fillRotate[d];
+        Squares g = gen[d], p = pro[d] & fillWrap[d];
+        g |= p & std::rotl(g, r);
+        p &= std::rotl(p, r);
+        g |= p & std::rotl(g, 2 * r);
+        p &= std::rotl(p, 2 * r);
+        g |= p & std::rotl(g, 4 * r);
+        out[d] = std::rotl(g, r) & fillWrap[d];
+    }
+}
+
+#if defined(FILL_AVX512)
+inline __m512i fillVector(__m512i g, __m512i p) {
+    __m512i r1 = _mm512_load_si512(fillRotate);
+    __m512i r2 = _mm512_and_si512(_mm512_slli_epi64(r1, 1), _mm512_set1_epi64(63));
+    __m512i r4 = _mm512_and_si512(_mm512_slli_epi64(r1, 2), _mm512_set1_epi64(63));
+    __m512i wrap = _mm512_load_si512(fillWrap);
+    p = _mm512_and_si512(p, wrap);
+    g = _mm512_or_si512(g, _mm512_and_si512(p, _mm512_rolv_epi64(g, r1)));
+    p = _mm512_and_si512(p, _mm512_rolv_epi64(p, r1));
+    g = _mm512_or_si512(g, _mm512_and_si512(p, _mm512_rolv_epi64(g, r2)));
+    p = _mm512_and_si512(p, _mm512_rolv_epi64(p, r2));
+    g = _mm512_or_si512(g, _mm512_and_si512(p, _mm512_rolv_epi64(g, r4)));
+    return _mm512_and_si512(_mm512_rolv_epi64(g, r1), wrap);
+}
+
+inline void fill(const Squares *gen, const Squares *pro, Squares *out) {
+    _mm512_storeu_si512(out, fillVector(_mm512_loadu_si512(gen), _mm512_loadu_si512(pro)));
+}
+#elif defined(FILL_AVX2)
+// the even directions shift left and the odd ones right; shifts drop the bits leaving the board, so only
+// the file wraps are masked. Unpacking the two halves of the arrays puts N, NE, E, NW in one vector and
+// S, SW, W, SE in the other, both by 8, 9, 1, 7
+template<bool left>
+__m256i fillLanes(__m256i g, __m256i p, __m256i wrap) {
+    auto shift = [](__m256i x, __m256i n) { return left ? _mm256_sllv_epi64(x, n) : _mm256_srlv_epi64(x, n); };
+    __m256i s1 = _mm256_setr_epi64x(8, 9, 1, 7), s2 = _mm256_slli_epi64(s1, 1), s4 = _mm256_slli_epi64(s1, 2);
+    p = _mm256_and_si256(p, wrap);
+    g = _mm256_or_si256(g, _mm256_and_si256(p, shift(g, s1)));
+    p = _mm256_and_si256(p, shift(p, s1));
+    g = _mm256_or_si256(g, _mm256_and_si256(p, shift(g, s2)));
+    p = _mm256_and_si256(p, shift(p, s2));
+    g = _mm256_or_si256(g, _mm256_and_si256(p, shift(g, s4)));
+    return _mm256_and_si256(shift(g, s1), wrap);
+}
+
+inline void fill(const Squares *gen, const Squares *pro, Squares *out) {
+    auto load = [](const Squares *x) { return _mm256_loadu_si256((const __m256i *) x); };
+    __m256i g0 = load(gen), g1 = load(gen + 4), p0 = load(pro), p1 = load(pro + 4), w0 = load(fillWrap), w1 = load(fillWrap + 4);
+    __m256i left = fillLanes<true>(_mm256_unpacklo_epi64(g0, g1), _mm256_unpacklo_epi64(p0, p1), _mm256_unpacklo_epi64(w0, w1));
+    __m256i right = fillLanes<false>(_mm256_unpackhi_epi64(g0, g1), _mm256_unpackhi_epi64(p0, p1), _mm256_unpackhi_epi64(w0, w1));
+    _mm256_storeu_si256((__m256i *) out, _mm256_unpacklo_epi64(left, right));
+    _mm256_storeu_si256((__m256i *) (out + 4), _mm256_unpackhi_epi64(left, right));
+}
+#else
+inline void fill(const Squares *gen, const Squares *pro, Squares *out) { fillScalar(gen, pro, out); }
+#endif
+
+// the part of the statusReport that comes from the enemy sliders
+struct SliderReport {
+    Squares seen;
+    Squares checkMask;
+    Squares kingBan;
+    Squares pinHV;
+    Squares pinD;
+    uint64_t checkCount;
+};
+
+// three fills: the enemy slider attacks, the lines seen from the king, and the king lines again through
+// the pinned pieces up to their pinners. As in check(), the first piece seen from the king is pinned,
+// whatever its colour, when an enemy slider of the line sees it from the far side
+template<void (*fillFn)(const Squares *, const Squares *, Squares *)>
+SliderReport sliderFill(Squares rookLike, Squares bishopLike, Squares king, Squares occ) {
+    SliderReport report {0, 0, 0, 0, 0, 0};
+    Squares empty = ~occ, occNotKing = occ & ~king;
+    uint64_t kingIndex = _tzcnt_u64(king);
+
+    alignas(64) Squares gen[8] {rookLike, rookLike, rookLike, rookLike, bishopLike, bishopLike, bishopLike, bishopLike};
+    alignas(64) Squares pro[8] {empty, empty, empty, empty, empty, empty, empty, empty};
+    alignas(64) Squares enemyRays[8], kingRays[8], pinRays[8];
+    fillFn(gen, pro, enemyRays);
+    for (int d = 0; d < 8; d++) gen[d] = king;
+    fillFn(gen, pro, kingRays);
+
+    Squares pinned = 0;
+    for (int d = 0; d < 8; d++) {
+        report.seen |= enemyRays[d];
+        if (kingRays[d] & (d < 4 ? rookLike : bishopLike)) { // the first piece seen from the king gives check
+            report.checkMask |= kingRays[d];
+            report.kingBan |= rays[d ^ 1][kingIndex];
+            report.checkCount++;
+        }
+        Squares pinnedD = kingRays[d] & occNotKing & enemyRays[d ^ 1];
+        gen[d] = pinnedD ? king : 0;
+        pro[d] = empty | pinnedD;
+        pinned |= pinnedD;
+    }
+    if (!pinned) return report;
+
+    fillFn(gen, pro, pinRays);
+    report.pinHV = pinRays[0] | pinRays[1] | pinRays[2] | pinRays[3];
+    report.pinD = pinRays[4] | pinRays[5] | pinRays[6] | pinRays[7];
+    return report;
+}
+
+#if defined(FILL_AVX512)
+// same as sliderFill, without leaving the registers: checks and pins are lane masks
+inline SliderReport sliderFill512(Squares rookLike, Squares bishopLike, Squares king, Squares occ) {
+    SliderReport report {0, 0, 0, 0, 0, 0};
+    __m512i gen = _mm512_mask_blend_epi64(0xf0, _mm512_set1_epi64(rookLike), _mm512_set1_epi64(bishopLike));
+    __m512i empty = _mm512_set1_epi64(~occ), kingV = _mm512_set1_epi64(king);
+    __m512i enemyRays = fillVector(gen, empty);
+    __m512i kingRays = fillVector(kingV, empty);
+    report.seen = _mm512_reduce_or_epi64(enemyRays);
+
+    __mmask8 checks = _mm512_test_epi64_mask(kingRays, gen);
+    if (checks) {
+        uint64_t kingIndex = _tzcnt_u64(king);
+        report.checkCount = _popcnt32(checks);
+        report.checkMask = _mm512_mask_reduce_or_epi64(checks, kingRays);
+        BitLoop(checks) report.kingBan |= rays[_tzcnt_u64(temp) ^ 1][kingIndex];
+    }
+
+    // d^1 swaps the two lanes of every 128 bit pair
+    __m512i opposite = _mm512_shuffle_epi32(enemyRays, _MM_PERM_BADC);
+    __m512i pinned = _mm512_and_si512(_mm512_and_si512(kingRays, opposite), _mm512_set1_epi64(occ & ~king));
+    __mmask8 pinLanes = _mm512_test_epi64_mask(pinned, pinned);
+    if (!pinLanes) return report;
+
+    __m512i pinRays = fillVector(_mm512_maskz_mov_epi64(pinLanes, kingV), _mm512_or_si512(empty, pinned));
+    report.pinHV = _mm512_mask_reduce_or_epi64(0x0f, pinRays);
+    report.pinD = _mm512_mask_reduce_or_epi64(0xf0, pinRays);
+    return report;
+}
+#endif
+
+// same report as check<isWhite, ep>(self, enemy), with the enemy slider attacks, the checks and the pins
+// taken from the set-wise fills instead of one slide() per enemy slider. vector picks the compiled
+// backend, the scalar fill otherwise
+template<bool isWhite, bool ep, bool vector = true>
+statusReport checkFill(const Pieces &self, const Pieces &enemy) {
+    Squares selfOcc = self.occupied();
+    Squares enemyOcc = enemy.occupied();
+    Squares occ = selfOcc | enemyOcc;
+    Squares occNotKing = occ & ~self.k;
+    uint64_t kingIndex = _tzcnt_u64(self.k);
+    Squares rookLike = enemy.r | enemy.q;
+
+    SliderReport sliders;
+#if defined(FILL_AVX512)
+    if constexpr (vector) sliders = sliderFill512(rookLike, enemy.b | enemy.q, self.k, occ);
+#else
+    if constexpr (vector) sliders = sliderFill<fill>(rookLike, enemy.b | enemy.q, self.k, occ);
+#endif
+    else sliders = sliderFill<fillScalar>(rookLike, enemy.b | enemy.q, self.k, occ);
+
+    uint64_t checkCount = sliders.checkCount;
+    Squares checkMask = sliders.checkMask, kingBan = sliders.kingBan, enemySeen = sliders.seen, epPin = 0;
+
+    // two pieces between the king and an enemy rook or queen on its rank, see check()
+    if constexpr (ep) {
+        BitLoop(rookLike & rookMoves[kingIndex] & (0xffULL << (kingIndex & ~7ULL))) {
+            uint64_t pieceIndex = _tzcnt_u64(temp);
+            Squares inbetween = (pinRay(kingIndex, pieceIndex) ^ _blsi_u64(temp)) & occNotKing;
+            Squares onePieceRemoved = _blsr_u64(inbetween);
+            if (onePieceRemoved && !_blsr_u64(onePieceRemoved)) epPin |= inbetween & self.p;
+        }
+    }
+
+    BitLoop(enemy.n) {
+        Squares atk = knightMoves[_tzcnt_u64(temp)];
+        enemySeen |= atk;
+        if (atk & self.k) {
+            checkCount++;
+            checkMask |= _blsi_u64(temp);
+        }
+    }
+
+    Squares atkL;
+    Squares atkR;
+    if constexpr (isWhite) {
+        atkL = (enemy.p & notAfile) >> 9;
+        atkR = (enemy.p & notHfile) >> 7;
+        if (atkL & self.k) {checkMask |= (self.k << 9) & enemy.p; checkCount++;}
+        if (atkR & self.k) {checkMask |= (self.k << 7) & enemy.p; checkCount++;}
+    } else {
+        atkL = (enemy.p & notAfile) << 7;
+        atkR = (enemy.p & notHfile) << 9;
+        if (atkL & self.k) {checkMask |= (self.k >> 7) & enemy.p; checkCount++;}
+        if (atkR & self.k) {checkMask |= (self.k >> 9) & enemy.p; checkCount++;}
+    }
+    enemySeen |= atkL | atkR;
+    enemySeen |= kingMoves[_tzcnt_u64(enemy.k)];
+
+    return {checkCount, kingIndex, checkMask, kingBan, sliders.pinHV, sliders.pinD, enemySeen, selfOcc, enemyOcc, epPin};
+}
+
+#if defined(FILL_AVX512) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
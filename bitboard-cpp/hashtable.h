@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+inline thread_local uint64_t tableProbes = 0; // per thread, added to the table totals by PerftTable::collect
+inline thread_local uint64_t tableHits = 0;
+
+// perft node counts keyed by position hash and depth, shared between threads without locks.
+// Every entry stores key ^ data next to data, so an entry torn by two concurrent writers no longer
+// verifies and reads as a miss. data packs the count in the high 56 bits and the depth in the low 8.
+class PerftTable {
+public:
+    // sizeMB == 0 disables the table, otherwise rounded down to a power of two buckets
+    void resize(size_t sizeMB) {
+        buckets.reset();
+        mask = 0;
+        clearStats();
+        if (sizeMB == 0) return;
+
+        size_t count = 1;
+        while (count * 2 * sizeof(Bucket) <= sizeMB * 1024 * 1024) count *= 2;
+        buckets.reset(new Bucket[count]);
+        mask = count - 1;
+    }
+
+    bool enabled() const { return mask != 0; }
+    size_t sizeBytes() const { return enabled() ? (mask + 1) * sizeof(Bucket) : 0; }
+
+    bool probe(uint64_t hash, int depth, uint64_t &count) {
+        uint64_t key = keyOf(hash, depth);
+        Bucket &bucket = buckets[key & mask];
+        tableProbes++;
+        for (auto &entry : bucket.entries) {
+            uint64_t data = entry.data.load(std::memory_order_relaxed);
+            if ((entry.key.load(std::memory_order_relaxed) ^ data) == key && (data & 0xff) == (uint64_t) depth) {
+                count = data >> 8;
+                tableHits++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the first entry of a bucket keeps the deepest result, the second one is always replaced
+    void store(uint64_t hash, int depth, uint64_t count) {
+        uint64_t key = keyOf(hash, depth);
+        Bucket &bucket = buckets[key & mask];
+        uint64_t data = count << 8 | (uint64_t) depth;
+
+        Entry &deep = bucket.entries[0];
+        Entry &entry = (int) (deep.data.load(std::memory_order_relaxed) & 0xff) <= depth ? deep : bucket.entries[1];
+        entry.key.store(key ^ data, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+    }
+
+    // adds the calling thread's probe and hit counts to the totals
+    void collect() {
+        probes += tableProbes;
+        hits += tableHits;
+        tableProbes = 0;
+        tableHits = 0;
+    }
+
+    void clearStats() {
+        probes = 0;
+        hits = 0;
+    }
+
+    uint64_t probeCount() const { return probes; }
+    uint64_t hitCount() const { return hits; }
+
+    // fraction of used entries, sampled from the start of the table
+    double fill() const {
+        if (!enabled()) return 0;
+        size_t sample = mask + 1 < 1000 ? mask + 1 : 1000;
+        size_t used = 0;
+        for (size_t i = 0; i < sample; i++) {
+            for (auto &entry : buckets[i].entries) used += entry.data.load(std::memory_order_relaxed) != 0;
+        }
+        return (double) used / (2 * sample);
+    }
+
+private:
+    struct Entry {
+        std::atomic<uint64_t> key {0};
+        std::atomic<uint64_t> data {0};
+    };
+
+    struct alignas(32) Bucket {
+        Entry entries[2];
+    };
+
+    std::unique_ptr<Bucket[]> buckets;
+    size_t mask = 0;
+    std::atomic<uint64_t> probes {0};
+    std::atomic<uint64_t> hits {0};
+
+    static uint64_t keyOf(uint64_t hash, int depth) { return hash ^ (uint64_t) depth * 0x9e3779b97f4a7c15ULL; }
+};
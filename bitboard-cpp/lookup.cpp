@@ -1,278 +1,20 @@
-#include <cstdint>
-#include <immintrin.h>
-
-uint64_t positionToBit[64] {1ULL, 1ULL<<1, 1ULL<<2, 1ULL<<3, 1ULL<<4, 1ULL<<5, 1ULL<<6, 1ULL<<7, 
-1ULL<<8, 1ULL<<9, 1ULL<<10, 1ULL<<11, 1ULL<<12, 1ULL<<13, 1ULL<<14, 1ULL<<15, 1ULL<<16, 1ULL<<17, 
-1ULL<<18, 1ULL<<19, 1ULL<<20, 1ULL<<21, 1ULL<<22, 1ULL<<23, 1ULL<<24, 1ULL<<25, 1ULL<<26, 1ULL<<27, 
-1ULL<<28, 1ULL<<29, 1ULL<<30, 1ULL<<31, 1ULL<<32, 1ULL<<33, 1ULL<<34, 1ULL<<35, 1ULL<<36, 1ULL<<37, 
-1ULL<<38, 1ULL<<39, 1ULL<<40, 1ULL<<41, 1ULL<<42, 1ULL<<43, 1ULL<<44, 1ULL<<45, 1ULL<<46, 1ULL<<47, 
-1ULL<<48, 1ULL<<49, 1ULL<<50, 1ULL<<51, 1ULL<<52, 1ULL<<53, 1ULL<<54, 1ULL<<55, 1ULL<<56, 1ULL<<57, 
-1ULL<<58, 1ULL<<59, 1ULL<<60, 1ULL<<61, 1ULL<<62, 1ULL<<63};
-
-uint64_t kingMoves[64] {770ULL, 1797ULL, 3594ULL, 7188ULL, 14376ULL, 28752ULL, 57504ULL, 49216ULL, 
-197123ULL, 460039ULL, 920078ULL, 1840156ULL, 3680312ULL, 7360624ULL, 14721248ULL, 12599488ULL, 
-50463488ULL, 117769984ULL, 235539968ULL, 471079936ULL, 942159872ULL, 1884319744ULL, 3768639488ULL, 
-3225468928ULL, 12918652928ULL, 30149115904ULL, 60298231808ULL, 120596463616ULL, 241192927232ULL, 
-482385854464ULL, 964771708928ULL, 825720045568ULL, 3307175149568ULL, 7718173671424ULL, 15436347342848ULL, 
-30872694685696ULL, 61745389371392ULL, 123490778742784ULL, 246981557485568ULL, 211384331665408ULL, 
-846636838289408ULL, 1975852459884544ULL, 3951704919769088ULL, 7903409839538176ULL, 15806819679076352ULL, 
-31613639358152704ULL, 63227278716305408ULL, 54114388906344448ULL, 216739030602088448ULL, 505818229730443264ULL, 
-1011636459460886528ULL, 2023272918921773056ULL, 4046545837843546112ULL, 8093091675687092224ULL, 16186183351374184448ULL, 
-13853283560024178688ULL, 144959613005987840ULL, 362258295026614272ULL, 724516590053228544ULL, 1449033180106457088ULL, 
-2898066360212914176ULL, 5796132720425828352ULL, 11592265440851656704ULL, 4665729213955833856ULL};
-
-uint64_t knightMoves[64] {132096ULL, 329728ULL, 659712ULL, 1319424ULL, 2638848ULL, 5277696ULL, 10489856ULL, 4202496ULL, 
-33816580ULL, 84410376ULL, 168886289ULL, 337772578ULL, 675545156ULL, 1351090312ULL, 2685403152ULL, 1075839008ULL, 
-8657044482ULL, 21609056261ULL, 43234889994ULL, 86469779988ULL, 172939559976ULL, 345879119952ULL, 687463207072ULL, 
-275414786112ULL, 2216203387392ULL, 5531918402816ULL, 11068131838464ULL, 22136263676928ULL, 44272527353856ULL, 
-88545054707712ULL, 175990581010432ULL, 70506185244672ULL, 567348067172352ULL, 1416171111120896ULL, 2833441750646784ULL, 
-5666883501293568ULL, 11333767002587136ULL, 22667534005174272ULL, 45053588738670592ULL, 18049583422636032ULL, 
-145241105196122112ULL, 362539804446949376ULL, 725361088165576704ULL, 1450722176331153408ULL, 2901444352662306816ULL, 
-5802888705324613632ULL, 11533718717099671552ULL, 4620693356194824192ULL, 288234782788157440ULL, 576469569871282176ULL, 
-1224997833292120064ULL, 2449995666584240128ULL, 4899991333168480256ULL, 9799982666336960512ULL, 1152939783987658752ULL, 
-2305878468463689728ULL, 1128098930098176ULL, 2257297371824128ULL, 4796069720358912ULL, 9592139440717824ULL, 
-19184278881435648ULL, 38368557762871296ULL, 4679521487814656ULL, 9077567998918656ULL};
-
-uint64_t bishopMoves[64] {9241421688590303744ULL, 36099303471056128ULL, 141012904249856ULL, 550848566272ULL, 6480472064ULL, 
-1108177604608ULL, 283691315142656ULL, 72624976668147712ULL, 4620710844295151618ULL, 9241421688590368773ULL, 
-36099303487963146ULL, 141017232965652ULL, 1659000848424ULL, 283693466779728ULL, 72624976676520096ULL, 
-145249953336262720ULL, 2310355422147510788ULL, 4620710844311799048ULL, 9241421692918565393ULL, 36100411639206946ULL, 
-424704217196612ULL, 72625527495610504ULL, 145249955479592976ULL, 290499906664153120ULL, 1155177711057110024ULL, 
-2310355426409252880ULL, 4620711952330133792ULL, 9241705379636978241ULL, 108724279602332802ULL, 145390965166737412ULL, 
-290500455356698632ULL, 580999811184992272ULL, 577588851267340304ULL, 1155178802063085600ULL, 2310639079102947392ULL, 
-4693335752243822976ULL, 9386671504487645697ULL, 326598935265674242ULL, 581140276476643332ULL, 1161999073681608712ULL, 
-288793334762704928ULL, 577868148797087808ULL, 1227793891648880768ULL, 2455587783297826816ULL, 4911175566595588352ULL, 
-9822351133174399489ULL, 1197958188344280066ULL, 2323857683139004420ULL, 144117404414255168ULL, 360293502378066048ULL, 
-720587009051099136ULL, 1441174018118909952ULL, 2882348036221108224ULL, 5764696068147249408ULL, 11529391036782871041ULL, 
-4611756524879479810ULL, 567382630219904ULL, 1416240237150208ULL, 2833579985862656ULL, 5667164249915392ULL, 11334324221640704ULL, 
-22667548931719168ULL, 45053622886727936ULL, 18049651735527937ULL};
-
-uint64_t rookMoves[64] {72340172838076926ULL, 144680345676153597ULL, 289360691352306939ULL, 578721382704613623ULL, 1157442765409226991ULL, 
-2314885530818453727ULL, 4629771061636907199ULL, 9259542123273814143ULL, 72340172838141441ULL, 144680345676217602ULL, 
-289360691352369924ULL, 578721382704674568ULL, 1157442765409283856ULL, 2314885530818502432ULL, 4629771061636939584ULL, 
-9259542123273813888ULL, 72340172854657281ULL, 144680345692602882ULL, 289360691368494084ULL, 578721382720276488ULL, 1157442765423841296ULL, 
-2314885530830970912ULL, 4629771061645230144ULL, 9259542123273748608ULL, 72340177082712321ULL, 144680349887234562ULL, 289360695496279044ULL, 
-578721386714368008ULL, 1157442769150545936ULL, 2314885534022901792ULL, 4629771063767613504ULL, 9259542123257036928ULL, 72341259464802561ULL, 
-144681423712944642ULL, 289361752209228804ULL, 578722409201797128ULL, 1157443723186933776ULL, 2314886351157207072ULL, 4629771607097753664ULL, 
-9259542118978846848ULL, 72618349279904001ULL, 144956323094725122ULL, 289632270724367364ULL, 578984165983651848ULL, 1157687956502220816ULL, 
-2315095537539358752ULL, 4629910699613634624ULL, 9259541023762186368ULL, 143553341945872641ULL, 215330564830528002ULL, 358885010599838724ULL, 
-645993902138460168ULL, 1220211685215703056ULL, 2368647251370188832ULL, 4665518383679160384ULL, 9259260648297103488ULL, 18302911464433844481ULL, 
-18231136449196065282ULL, 18087586418720506884ULL, 17800486357769390088ULL, 17226286235867156496ULL, 16077885992062689312ULL, 
-13781085504453754944ULL, 9187484529235886208ULL};
-
-uint64_t queenMoves[64] {9313761861428380670ULL, 180779649147209725ULL, 289501704256556795ULL, 578721933553179895ULL, 1157442771889699055ULL, 
-2314886638996058335ULL, 4630054752952049855ULL, 9332167099941961855ULL, 4693051017133293059ULL, 9386102034266586375ULL, 325459994840333070ULL, 
-578862399937640220ULL, 1157444424410132280ULL, 2315169224285282160ULL, 4702396038313459680ULL, 9404792076610076608ULL, 2382695595002168069ULL, 
-4765391190004401930ULL, 9530782384287059477ULL, 614821794359483434ULL, 1157867469641037908ULL, 2387511058326581416ULL, 4775021017124823120ULL, 
-9550042029937901728ULL, 1227517888139822345ULL, 2455035776296487442ULL, 4910072647826412836ULL, 9820426766351346249ULL, 1266167048752878738ULL, 
-2460276499189639204ULL, 4920271519124312136ULL, 9840541934442029200ULL, 649930110732142865ULL, 1299860225776030242ULL, 2600000831312176196ULL, 
-5272058161445620104ULL, 10544115227674579473ULL, 2641485286422881314ULL, 5210911883574396996ULL, 10421541192660455560ULL, 361411684042608929ULL, 
-722824471891812930ULL, 1517426162373248132ULL, 3034571949281478664ULL, 6068863523097809168ULL, 12137446670713758241ULL, 5827868887957914690ULL, 
-11583398706901190788ULL, 287670746360127809ULL, 575624067208594050ULL, 1079472019650937860ULL, 2087167920257370120ULL, 4102559721436811280ULL, 
-8133343319517438240ULL, 16194909420462031425ULL, 13871017173176583298ULL, 18303478847064064385ULL, 18232552689433215490ULL, 18090419998706369540ULL, 
-17806153522019305480ULL, 17237620560088797200ULL, 16100553540994408480ULL, 13826139127340482880ULL, 9205534180971414145ULL};
-
-// Path between King and Enemy including the Enemy. Zero if not a slider
-uint64_t PinBetween[64][64] = {{0ULL, 0x2ULL, 0x6ULL, 0xeULL, 0x1eULL, 0x3eULL, 0x7eULL, 0xfeULL, 0x100ULL, 0x200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10100ULL, 0ULL, 0x40200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010100ULL, 0ULL, 0ULL, 0x8040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010100ULL, 0ULL, 0ULL, 0ULL, 0x1008040200ULL, 0ULL, 0ULL, 0ULL, 0x10101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201008040200ULL, 0ULL, 0ULL, 0x1010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008040200ULL, 0ULL, 0x101010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040201008040200ULL},
-{0x1ULL, 0ULL, 0x4ULL, 0xcULL, 0x1cULL, 0x3cULL, 0x7cULL, 0xfcULL, 0x100ULL, 0x200ULL, 0x400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20200ULL, 0ULL, 0x80400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020200ULL, 0ULL, 0ULL, 0x10080400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020200ULL, 0ULL, 0ULL, 0ULL, 0x2010080400ULL, 0ULL, 0ULL, 0ULL, 0x20202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010080400ULL, 0ULL, 0ULL, 0x2020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402010080400ULL, 0ULL, 0x202020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0x3ULL, 0x2ULL, 0ULL, 0x8ULL, 0x18ULL, 0x38ULL, 0x78ULL, 0xf8ULL, 0ULL, 0x200ULL, 0x400ULL, 0x800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10200ULL, 0ULL, 0x40400ULL, 0ULL, 0x100800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040400ULL, 0ULL, 0ULL, 0x20100800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040400ULL, 0ULL, 0ULL, 0ULL, 0x4020100800ULL, 0ULL, 0ULL, 0ULL, 0x40404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804020100800ULL, 0ULL, 0ULL, 0x4040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0x7ULL, 0x6ULL, 0x4ULL, 0ULL, 0x10ULL, 0x30ULL, 0x70ULL, 0xf0ULL, 0ULL, 0ULL, 0x400ULL, 0x800ULL, 0x1000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400ULL, 0ULL, 0x80800ULL, 0ULL, 0x201000ULL, 0ULL, 0ULL, 0x1020400ULL, 0ULL, 0ULL, 0x8080800ULL, 0ULL, 0ULL, 0x40201000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080800ULL, 0ULL, 0ULL, 0ULL, 0x8040201000ULL, 0ULL, 0ULL, 0ULL, 0x80808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0xfULL, 0xeULL, 0xcULL, 0x8ULL, 0ULL, 0x20ULL, 0x60ULL, 0xe0ULL, 0ULL, 0ULL, 0ULL, 0x800ULL, 0x1000ULL, 0x2000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800ULL, 0ULL, 0x101000ULL, 0ULL, 0x402000ULL, 0ULL, 0ULL, 0x2040800ULL, 0ULL, 0ULL, 0x10101000ULL, 0ULL, 0ULL, 0x80402000ULL, 0x102040800ULL, 0ULL, 0ULL, 0ULL, 0x1010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010101000ULL, 0ULL, 0ULL, 0ULL},
-{0x1fULL, 0x1eULL, 0x1cULL, 0x18ULL, 0x10ULL, 0ULL, 0x40ULL, 0xc0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000ULL, 0x2000ULL, 0x4000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81000ULL, 0ULL, 0x202000ULL, 0ULL, 0x804000ULL, 0ULL, 0ULL, 0x4081000ULL, 0ULL, 0ULL, 0x20202000ULL, 0ULL, 0ULL, 0ULL, 0x204081000ULL, 0ULL, 0ULL, 0ULL, 0x2020202000ULL, 0ULL, 0ULL, 0x10204081000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020202000ULL, 0ULL, 0ULL},
-{0x3fULL, 0x3eULL, 0x3cULL, 0x38ULL, 0x30ULL, 0x20ULL, 0ULL, 0x80ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000ULL, 0x4000ULL, 0x8000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102000ULL, 0ULL, 0x404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8102000ULL, 0ULL, 0ULL, 0x40404000ULL, 0ULL, 0ULL, 0ULL, 0x408102000ULL, 0ULL, 0ULL, 0ULL, 0x4040404000ULL, 0ULL, 0ULL, 0x20408102000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404000ULL, 0ULL, 0x1020408102000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040404000ULL, 0ULL},
-{0x7fULL, 0x7eULL, 0x7cULL, 0x78ULL, 0x70ULL, 0x60ULL, 0x40ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000ULL, 0x8000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000ULL, 0ULL, 0x808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204000ULL, 0ULL, 0ULL, 0x80808000ULL, 0ULL, 0ULL, 0ULL, 0x810204000ULL, 0ULL, 0ULL, 0ULL, 0x8080808000ULL, 0ULL, 0ULL, 0x40810204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808000ULL, 0ULL, 0x2040810204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808000ULL, 0x102040810204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080808000ULL},
-{0x1ULL, 0x2ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200ULL, 0x600ULL, 0xe00ULL, 0x1e00ULL, 0x3e00ULL, 0x7e00ULL, 0xfe00ULL, 0x10000ULL, 0x20000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000ULL, 0ULL, 0x4020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010000ULL, 0ULL, 0ULL, 0x804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010000ULL, 0ULL, 0ULL, 0ULL, 0x100804020000ULL, 0ULL, 0ULL, 0ULL, 0x1010101010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100804020000ULL, 0ULL, 0ULL, 0x101010101010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100804020000ULL, 0ULL},
-{0x1ULL, 0x2ULL, 0x4ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100ULL, 0ULL, 0x400ULL, 0xc00ULL, 0x1c00ULL, 0x3c00ULL, 0x7c00ULL, 0xfc00ULL, 0x10000ULL, 0x20000ULL, 0x40000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020000ULL, 0ULL, 0x8040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020000ULL, 0ULL, 0ULL, 0x1008040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020000ULL, 0ULL, 0ULL, 0ULL, 0x201008040000ULL, 0ULL, 0ULL, 0ULL, 0x2020202020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008040000ULL, 0ULL, 0ULL, 0x202020202020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040201008040000ULL},
-{0ULL, 0x2ULL, 0x4ULL, 0x8ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x300ULL, 0x200ULL, 0ULL, 0x800ULL, 0x1800ULL, 0x3800ULL, 0x7800ULL, 0xf800ULL, 0ULL, 0x20000ULL, 0x40000ULL, 0x80000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020000ULL, 0ULL, 0x4040000ULL, 0ULL, 0x10080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040000ULL, 0ULL, 0ULL, 0x2010080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040000ULL, 0ULL, 0ULL, 0ULL, 0x402010080000ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402010080000ULL, 0ULL, 0ULL, 0x404040404040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x4ULL, 0x8ULL, 0x10ULL, 0ULL, 0ULL, 0ULL, 0x700ULL, 0x600ULL, 0x400ULL, 0ULL, 0x1000ULL, 0x3000ULL, 0x7000ULL, 0xf000ULL, 0ULL, 0ULL, 0x40000ULL, 0x80000ULL, 0x100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040000ULL, 0ULL, 0x8080000ULL, 0ULL, 0x20100000ULL, 0ULL, 0ULL, 0x102040000ULL, 0ULL, 0ULL, 0x808080000ULL, 0ULL, 0ULL, 0x4020100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080000ULL, 0ULL, 0ULL, 0ULL, 0x804020100000ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x8ULL, 0x10ULL, 0x20ULL, 0ULL, 0ULL, 0xf00ULL, 0xe00ULL, 0xc00ULL, 0x800ULL, 0ULL, 0x2000ULL, 0x6000ULL, 0xe000ULL, 0ULL, 0ULL, 0ULL, 0x80000ULL, 0x100000ULL, 0x200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080000ULL, 0ULL, 0x10100000ULL, 0ULL, 0x40200000ULL, 0ULL, 0ULL, 0x204080000ULL, 0ULL, 0ULL, 0x1010100000ULL, 0ULL, 0ULL, 0x8040200000ULL, 0x10204080000ULL, 0ULL, 0ULL, 0ULL, 0x101010100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010100000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x10ULL, 0x20ULL, 0x40ULL, 0ULL, 0x1f00ULL, 0x1e00ULL, 0x1c00ULL, 0x1800ULL, 0x1000ULL, 0ULL, 0x4000ULL, 0xc000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000ULL, 0x200000ULL, 0x400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8100000ULL, 0ULL, 0x20200000ULL, 0ULL, 0x80400000ULL, 0ULL, 0ULL, 0x408100000ULL, 0ULL, 0ULL, 0x2020200000ULL, 0ULL, 0ULL, 0ULL, 0x20408100000ULL, 0ULL, 0ULL, 0ULL, 0x202020200000ULL, 0ULL, 0ULL, 0x1020408100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020200000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20ULL, 0x40ULL, 0x80ULL, 0x3f00ULL, 0x3e00ULL, 0x3c00ULL, 0x3800ULL, 0x3000ULL, 0x2000ULL, 0ULL, 0x8000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000ULL, 0x400000ULL, 0x800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10200000ULL, 0ULL, 0x40400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810200000ULL, 0ULL, 0ULL, 0x4040400000ULL, 0ULL, 0ULL, 0ULL, 0x40810200000ULL, 0ULL, 0ULL, 0ULL, 0x404040400000ULL, 0ULL, 0ULL, 0x2040810200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040400000ULL, 0ULL, 0x102040810200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040400000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40ULL, 0x80ULL, 0x7f00ULL, 0x7e00ULL, 0x7c00ULL, 0x7800ULL, 0x7000ULL, 0x6000ULL, 0x4000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000ULL, 0x800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400000ULL, 0ULL, 0x80800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020400000ULL, 0ULL, 0ULL, 0x8080800000ULL, 0ULL, 0ULL, 0ULL, 0x81020400000ULL, 0ULL, 0ULL, 0ULL, 0x808080800000ULL, 0ULL, 0ULL, 0x4081020400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080800000ULL, 0ULL, 0x204081020400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800000ULL},
-{0x101ULL, 0ULL, 0x204ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100ULL, 0x200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000ULL, 0x60000ULL, 0xe0000ULL, 0x1e0000ULL, 0x3e0000ULL, 0x7e0000ULL, 0xfe0000ULL, 0x1000000ULL, 0x2000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000ULL, 0ULL, 0x402000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101000000ULL, 0ULL, 0ULL, 0x80402000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101000000ULL, 0ULL, 0ULL, 0ULL, 0x10080402000000ULL, 0ULL, 0ULL, 0ULL, 0x101010101000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010080402000000ULL, 0ULL, 0ULL},
-{0ULL, 0x202ULL, 0ULL, 0x408ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100ULL, 0x200ULL, 0x400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000ULL, 0ULL, 0x40000ULL, 0xc0000ULL, 0x1c0000ULL, 0x3c0000ULL, 0x7c0000ULL, 0xfc0000ULL, 0x1000000ULL, 0x2000000ULL, 0x4000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202000000ULL, 0ULL, 0x804000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202000000ULL, 0ULL, 0ULL, 0x100804000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202000000ULL, 0ULL, 0ULL, 0ULL, 0x20100804000000ULL, 0ULL, 0ULL, 0ULL, 0x202020202000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100804000000ULL, 0ULL},
-{0x201ULL, 0ULL, 0x404ULL, 0ULL, 0x810ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200ULL, 0x400ULL, 0x800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x30000ULL, 0x20000ULL, 0ULL, 0x80000ULL, 0x180000ULL, 0x380000ULL, 0x780000ULL, 0xf80000ULL, 0ULL, 0x2000000ULL, 0x4000000ULL, 0x8000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102000000ULL, 0ULL, 0x404000000ULL, 0ULL, 0x1008000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404000000ULL, 0ULL, 0ULL, 0x201008000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404000000ULL, 0ULL, 0ULL, 0ULL, 0x40201008000000ULL, 0ULL, 0ULL, 0ULL, 0x404040404000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040201008000000ULL},
-{0ULL, 0x402ULL, 0ULL, 0x808ULL, 0ULL, 0x1020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400ULL, 0x800ULL, 0x1000ULL, 0ULL, 0ULL, 0ULL, 0x70000ULL, 0x60000ULL, 0x40000ULL, 0ULL, 0x100000ULL, 0x300000ULL, 0x700000ULL, 0xf00000ULL, 0ULL, 0ULL, 0x4000000ULL, 0x8000000ULL, 0x10000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000000ULL, 0ULL, 0x808000000ULL, 0ULL, 0x2010000000ULL, 0ULL, 0ULL, 0x10204000000ULL, 0ULL, 0ULL, 0x80808000000ULL, 0ULL, 0ULL, 0x402010000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808000000ULL, 0ULL, 0ULL, 0ULL, 0x80402010000000ULL, 0ULL, 0ULL, 0ULL, 0x808080808000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x804ULL, 0ULL, 0x1010ULL, 0ULL, 0x2040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800ULL, 0x1000ULL, 0x2000ULL, 0ULL, 0ULL, 0xf0000ULL, 0xe0000ULL, 0xc0000ULL, 0x80000ULL, 0ULL, 0x200000ULL, 0x600000ULL, 0xe00000ULL, 0ULL, 0ULL, 0ULL, 0x8000000ULL, 0x10000000ULL, 0x20000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000000ULL, 0ULL, 0x1010000000ULL, 0ULL, 0x4020000000ULL, 0ULL, 0ULL, 0x20408000000ULL, 0ULL, 0ULL, 0x101010000000ULL, 0ULL, 0ULL, 0x804020000000ULL, 0x1020408000000ULL, 0ULL, 0ULL, 0ULL, 0x10101010000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x1008ULL, 0ULL, 0x2020ULL, 0ULL, 0x4080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000ULL, 0x2000ULL, 0x4000ULL, 0ULL, 0x1f0000ULL, 0x1e0000ULL, 0x1c0000ULL, 0x180000ULL, 0x100000ULL, 0ULL, 0x400000ULL, 0xc00000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000ULL, 0x20000000ULL, 0x40000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810000000ULL, 0ULL, 0x2020000000ULL, 0ULL, 0x8040000000ULL, 0ULL, 0ULL, 0x40810000000ULL, 0ULL, 0ULL, 0x202020000000ULL, 0ULL, 0ULL, 0ULL, 0x2040810000000ULL, 0ULL, 0ULL, 0ULL, 0x20202020000000ULL, 0ULL, 0ULL, 0x102040810000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x2010ULL, 0ULL, 0x4040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000ULL, 0x4000ULL, 0x8000ULL, 0x3f0000ULL, 0x3e0000ULL, 0x3c0000ULL, 0x380000ULL, 0x300000ULL, 0x200000ULL, 0ULL, 0x800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000ULL, 0x40000000ULL, 0x80000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020000000ULL, 0ULL, 0x4040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81020000000ULL, 0ULL, 0ULL, 0x404040000000ULL, 0ULL, 0ULL, 0ULL, 0x4081020000000ULL, 0ULL, 0ULL, 0ULL, 0x40404040000000ULL, 0ULL, 0ULL, 0x204081020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020ULL, 0ULL, 0x8080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000ULL, 0x8000ULL, 0x7f0000ULL, 0x7e0000ULL, 0x7c0000ULL, 0x780000ULL, 0x700000ULL, 0x600000ULL, 0x400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000000ULL, 0x80000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040000000ULL, 0ULL, 0x8080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040000000ULL, 0ULL, 0ULL, 0x808080000000ULL, 0ULL, 0ULL, 0ULL, 0x8102040000000ULL, 0ULL, 0ULL, 0ULL, 0x80808080000000ULL, 0ULL, 0ULL, 0x408102040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000000ULL},
-{0x10101ULL, 0ULL, 0ULL, 0x20408ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10100ULL, 0ULL, 0x20400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000ULL, 0x20000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000ULL, 0x6000000ULL, 0xe000000ULL, 0x1e000000ULL, 0x3e000000ULL, 0x7e000000ULL, 0xfe000000ULL, 0x100000000ULL, 0x200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10100000000ULL, 0ULL, 0x40200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010100000000ULL, 0ULL, 0ULL, 0x8040200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010100000000ULL, 0ULL, 0ULL, 0ULL, 0x1008040200000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x20202ULL, 0ULL, 0ULL, 0x40810ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20200ULL, 0ULL, 0x40800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000ULL, 0x20000ULL, 0x40000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000ULL, 0ULL, 0x4000000ULL, 0xc000000ULL, 0x1c000000ULL, 0x3c000000ULL, 0x7c000000ULL, 0xfc000000ULL, 0x100000000ULL, 0x200000000ULL, 0x400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20200000000ULL, 0ULL, 0x80400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020200000000ULL, 0ULL, 0ULL, 0x10080400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020200000000ULL, 0ULL, 0ULL, 0ULL, 0x2010080400000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x40404ULL, 0ULL, 0ULL, 0x81020ULL, 0ULL, 0ULL, 0x20100ULL, 0ULL, 0x40400ULL, 0ULL, 0x81000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000ULL, 0x40000ULL, 0x80000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x3000000ULL, 0x2000000ULL, 0ULL, 0x8000000ULL, 0x18000000ULL, 0x38000000ULL, 0x78000000ULL, 0xf8000000ULL, 0ULL, 0x200000000ULL, 0x400000000ULL, 0x800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10200000000ULL, 0ULL, 0x40400000000ULL, 0ULL, 0x100800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040400000000ULL, 0ULL, 0ULL, 0x20100800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040400000000ULL, 0ULL, 0ULL, 0ULL, 0x4020100800000000ULL, 0ULL},
-{0x40201ULL, 0ULL, 0ULL, 0x80808ULL, 0ULL, 0ULL, 0x102040ULL, 0ULL, 0ULL, 0x40200ULL, 0ULL, 0x80800ULL, 0ULL, 0x102000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000ULL, 0x80000ULL, 0x100000ULL, 0ULL, 0ULL, 0ULL, 0x7000000ULL, 0x6000000ULL, 0x4000000ULL, 0ULL, 0x10000000ULL, 0x30000000ULL, 0x70000000ULL, 0xf0000000ULL, 0ULL, 0ULL, 0x400000000ULL, 0x800000000ULL, 0x1000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400000000ULL, 0ULL, 0x80800000000ULL, 0ULL, 0x201000000000ULL, 0ULL, 0ULL, 0x1020400000000ULL, 0ULL, 0ULL, 0x8080800000000ULL, 0ULL, 0ULL, 0x40201000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080800000000ULL, 0ULL, 0ULL, 0ULL, 0x8040201000000000ULL},
-{0ULL, 0x80402ULL, 0ULL, 0ULL, 0x101010ULL, 0ULL, 0ULL, 0x204080ULL, 0ULL, 0ULL, 0x80400ULL, 0ULL, 0x101000ULL, 0ULL, 0x204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000ULL, 0x100000ULL, 0x200000ULL, 0ULL, 0ULL, 0xf000000ULL, 0xe000000ULL, 0xc000000ULL, 0x8000000ULL, 0ULL, 0x20000000ULL, 0x60000000ULL, 0xe0000000ULL, 0ULL, 0ULL, 0ULL, 0x800000000ULL, 0x1000000000ULL, 0x2000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800000000ULL, 0ULL, 0x101000000000ULL, 0ULL, 0x402000000000ULL, 0ULL, 0ULL, 0x2040800000000ULL, 0ULL, 0ULL, 0x10101000000000ULL, 0ULL, 0ULL, 0x80402000000000ULL, 0x102040800000000ULL, 0ULL, 0ULL, 0ULL, 0x1010101000000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x100804ULL, 0ULL, 0ULL, 0x202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100800ULL, 0ULL, 0x202000ULL, 0ULL, 0x408000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000ULL, 0x200000ULL, 0x400000ULL, 0ULL, 0x1f000000ULL, 0x1e000000ULL, 0x1c000000ULL, 0x18000000ULL, 0x10000000ULL, 0ULL, 0x40000000ULL, 0xc0000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000ULL, 0x2000000000ULL, 0x4000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81000000000ULL, 0ULL, 0x202000000000ULL, 0ULL, 0x804000000000ULL, 0ULL, 0ULL, 0x4081000000000ULL, 0ULL, 0ULL, 0x20202000000000ULL, 0ULL, 0ULL, 0ULL, 0x204081000000000ULL, 0ULL, 0ULL, 0ULL, 0x2020202000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x201008ULL, 0ULL, 0ULL, 0x404040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201000ULL, 0ULL, 0x404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000ULL, 0x400000ULL, 0x800000ULL, 0x3f000000ULL, 0x3e000000ULL, 0x3c000000ULL, 0x38000000ULL, 0x30000000ULL, 0x20000000ULL, 0ULL, 0x80000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000ULL, 0x4000000000ULL, 0x8000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102000000000ULL, 0ULL, 0x404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8102000000000ULL, 0ULL, 0ULL, 0x40404000000000ULL, 0ULL, 0ULL, 0ULL, 0x408102000000000ULL, 0ULL, 0ULL, 0ULL, 0x4040404000000000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x402010ULL, 0ULL, 0ULL, 0x808080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402000ULL, 0ULL, 0x808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000ULL, 0x800000ULL, 0x7f000000ULL, 0x7e000000ULL, 0x7c000000ULL, 0x78000000ULL, 0x70000000ULL, 0x60000000ULL, 0x40000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000000ULL, 0x8000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000000000ULL, 0ULL, 0x808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204000000000ULL, 0ULL, 0ULL, 0x80808000000000ULL, 0ULL, 0ULL, 0ULL, 0x810204000000000ULL, 0ULL, 0ULL, 0ULL, 0x8080808000000000ULL},
-{0x1010101ULL, 0ULL, 0ULL, 0ULL, 0x2040810ULL, 0ULL, 0ULL, 0ULL, 0x1010100ULL, 0ULL, 0ULL, 0x2040800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000ULL, 0ULL, 0x2040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000ULL, 0x2000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000ULL, 0x600000000ULL, 0xe00000000ULL, 0x1e00000000ULL, 0x3e00000000ULL, 0x7e00000000ULL, 0xfe00000000ULL, 0x10000000000ULL, 0x20000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000000000ULL, 0ULL, 0x4020000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010000000000ULL, 0ULL, 0ULL, 0x804020000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x2020202ULL, 0ULL, 0ULL, 0ULL, 0x4081020ULL, 0ULL, 0ULL, 0ULL, 0x2020200ULL, 0ULL, 0ULL, 0x4081000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020000ULL, 0ULL, 0x4080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000ULL, 0x2000000ULL, 0x4000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000ULL, 0ULL, 0x400000000ULL, 0xc00000000ULL, 0x1c00000000ULL, 0x3c00000000ULL, 0x7c00000000ULL, 0xfc00000000ULL, 0x10000000000ULL, 0x20000000000ULL, 0x40000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020000000000ULL, 0ULL, 0x8040000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020000000000ULL, 0ULL, 0ULL, 0x1008040000000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x4040404ULL, 0ULL, 0ULL, 0ULL, 0x8102040ULL, 0ULL, 0ULL, 0ULL, 0x4040400ULL, 0ULL, 0ULL, 0x8102000ULL, 0ULL, 0ULL, 0x2010000ULL, 0ULL, 0x4040000ULL, 0ULL, 0x8100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000ULL, 0x4000000ULL, 0x8000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x300000000ULL, 0x200000000ULL, 0ULL, 0x800000000ULL, 0x1800000000ULL, 0x3800000000ULL, 0x7800000000ULL, 0xf800000000ULL, 0ULL, 0x20000000000ULL, 0x40000000000ULL, 0x80000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020000000000ULL, 0ULL, 0x4040000000000ULL, 0ULL, 0x10080000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040000000000ULL, 0ULL, 0ULL, 0x2010080000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x8080808ULL, 0ULL, 0ULL, 0ULL, 0x10204080ULL, 0x4020100ULL, 0ULL, 0ULL, 0x8080800ULL, 0ULL, 0ULL, 0x10204000ULL, 0ULL, 0ULL, 0x4020000ULL, 0ULL, 0x8080000ULL, 0ULL, 0x10200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000ULL, 0x8000000ULL, 0x10000000ULL, 0ULL, 0ULL, 0ULL, 0x700000000ULL, 0x600000000ULL, 0x400000000ULL, 0ULL, 0x1000000000ULL, 0x3000000000ULL, 0x7000000000ULL, 0xf000000000ULL, 0ULL, 0ULL, 0x40000000000ULL, 0x80000000000ULL, 0x100000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040000000000ULL, 0ULL, 0x8080000000000ULL, 0ULL, 0x20100000000000ULL, 0ULL, 0ULL, 0x102040000000000ULL, 0ULL, 0ULL, 0x808080000000000ULL, 0ULL, 0ULL, 0x4020100000000000ULL, 0ULL},
-{0x8040201ULL, 0ULL, 0ULL, 0ULL, 0x10101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200ULL, 0ULL, 0ULL, 0x10101000ULL, 0ULL, 0ULL, 0x20408000ULL, 0ULL, 0ULL, 0x8040000ULL, 0ULL, 0x10100000ULL, 0ULL, 0x20400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000000ULL, 0x10000000ULL, 0x20000000ULL, 0ULL, 0ULL, 0xf00000000ULL, 0xe00000000ULL, 0xc00000000ULL, 0x800000000ULL, 0ULL, 0x2000000000ULL, 0x6000000000ULL, 0xe000000000ULL, 0ULL, 0ULL, 0ULL, 0x80000000000ULL, 0x100000000000ULL, 0x200000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080000000000ULL, 0ULL, 0x10100000000000ULL, 0ULL, 0x40200000000000ULL, 0ULL, 0ULL, 0x204080000000000ULL, 0ULL, 0ULL, 0x1010100000000000ULL, 0ULL, 0ULL, 0x8040200000000000ULL},
-{0ULL, 0x10080402ULL, 0ULL, 0ULL, 0ULL, 0x20202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080400ULL, 0ULL, 0ULL, 0x20202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080000ULL, 0ULL, 0x20200000ULL, 0ULL, 0x40800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000ULL, 0x20000000ULL, 0x40000000ULL, 0ULL, 0x1f00000000ULL, 0x1e00000000ULL, 0x1c00000000ULL, 0x1800000000ULL, 0x1000000000ULL, 0ULL, 0x4000000000ULL, 0xc000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000000ULL, 0x200000000000ULL, 0x400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8100000000000ULL, 0ULL, 0x20200000000000ULL, 0ULL, 0x80400000000000ULL, 0ULL, 0ULL, 0x408100000000000ULL, 0ULL, 0ULL, 0x2020200000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x20100804ULL, 0ULL, 0ULL, 0ULL, 0x40404040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100800ULL, 0ULL, 0ULL, 0x40404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100000ULL, 0ULL, 0x40400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000ULL, 0x40000000ULL, 0x80000000ULL, 0x3f00000000ULL, 0x3e00000000ULL, 0x3c00000000ULL, 0x3800000000ULL, 0x3000000000ULL, 0x2000000000ULL, 0ULL, 0x8000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000000ULL, 0x400000000000ULL, 0x800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10200000000000ULL, 0ULL, 0x40400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810200000000000ULL, 0ULL, 0ULL, 0x4040400000000000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x40201008ULL, 0ULL, 0ULL, 0ULL, 0x80808080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201000ULL, 0ULL, 0ULL, 0x80808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40200000ULL, 0ULL, 0x80800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000000ULL, 0x80000000ULL, 0x7f00000000ULL, 0x7e00000000ULL, 0x7c00000000ULL, 0x7800000000ULL, 0x7000000000ULL, 0x6000000000ULL, 0x4000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000000000ULL, 0x800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400000000000ULL, 0ULL, 0x80800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020400000000000ULL, 0ULL, 0ULL, 0x8080800000000000ULL},
-{0x101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204081020ULL, 0ULL, 0ULL, 0x101010100ULL, 0ULL, 0ULL, 0ULL, 0x204081000ULL, 0ULL, 0ULL, 0ULL, 0x101010000ULL, 0ULL, 0ULL, 0x204080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000ULL, 0ULL, 0x204000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000ULL, 0x200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000000ULL, 0x60000000000ULL, 0xe0000000000ULL, 0x1e0000000000ULL, 0x3e0000000000ULL, 0x7e0000000000ULL, 0xfe0000000000ULL, 0x1000000000000ULL, 0x2000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000000000ULL, 0ULL, 0x402000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408102040ULL, 0ULL, 0ULL, 0x202020200ULL, 0ULL, 0ULL, 0ULL, 0x408102000ULL, 0ULL, 0ULL, 0ULL, 0x202020000ULL, 0ULL, 0ULL, 0x408100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202000000ULL, 0ULL, 0x408000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000ULL, 0x200000000ULL, 0x400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000ULL, 0ULL, 0x40000000000ULL, 0xc0000000000ULL, 0x1c0000000000ULL, 0x3c0000000000ULL, 0x7c0000000000ULL, 0xfc0000000000ULL, 0x1000000000000ULL, 0x2000000000000ULL, 0x4000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202000000000000ULL, 0ULL, 0x804000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810204080ULL, 0ULL, 0ULL, 0x404040400ULL, 0ULL, 0ULL, 0ULL, 0x810204000ULL, 0ULL, 0ULL, 0ULL, 0x404040000ULL, 0ULL, 0ULL, 0x810200000ULL, 0ULL, 0ULL, 0x201000000ULL, 0ULL, 0x404000000ULL, 0ULL, 0x810000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000ULL, 0x400000000ULL, 0x800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x30000000000ULL, 0x20000000000ULL, 0ULL, 0x80000000000ULL, 0x180000000000ULL, 0x380000000000ULL, 0x780000000000ULL, 0xf80000000000ULL, 0ULL, 0x2000000000000ULL, 0x4000000000000ULL, 0x8000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102000000000000ULL, 0ULL, 0x404000000000000ULL, 0ULL, 0x1008000000000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080800ULL, 0ULL, 0ULL, 0ULL, 0x1020408000ULL, 0x402010000ULL, 0ULL, 0ULL, 0x808080000ULL, 0ULL, 0ULL, 0x1020400000ULL, 0ULL, 0ULL, 0x402000000ULL, 0ULL, 0x808000000ULL, 0ULL, 0x1020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000000ULL, 0x800000000ULL, 0x1000000000ULL, 0ULL, 0ULL, 0ULL, 0x70000000000ULL, 0x60000000000ULL, 0x40000000000ULL, 0ULL, 0x100000000000ULL, 0x300000000000ULL, 0x700000000000ULL, 0xf00000000000ULL, 0ULL, 0ULL, 0x4000000000000ULL, 0x8000000000000ULL, 0x10000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000000000000ULL, 0ULL, 0x808000000000000ULL, 0ULL, 0x2010000000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010ULL, 0ULL, 0ULL, 0ULL, 0x804020100ULL, 0ULL, 0ULL, 0ULL, 0x1010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804020000ULL, 0ULL, 0ULL, 0x1010100000ULL, 0ULL, 0ULL, 0x2040800000ULL, 0ULL, 0ULL, 0x804000000ULL, 0ULL, 0x1010000000ULL, 0ULL, 0x2040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000000ULL, 0x1000000000ULL, 0x2000000000ULL, 0ULL, 0ULL, 0xf0000000000ULL, 0xe0000000000ULL, 0xc0000000000ULL, 0x80000000000ULL, 0ULL, 0x200000000000ULL, 0x600000000000ULL, 0xe00000000000ULL, 0ULL, 0ULL, 0ULL, 0x8000000000000ULL, 0x10000000000000ULL, 0x20000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000000000000ULL, 0ULL, 0x1010000000000000ULL, 0ULL, 0x4020000000000000ULL, 0ULL},
-{0x1008040201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020ULL, 0ULL, 0ULL, 0ULL, 0x1008040200ULL, 0ULL, 0ULL, 0ULL, 0x2020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008040000ULL, 0ULL, 0ULL, 0x2020200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008000000ULL, 0ULL, 0x2020000000ULL, 0ULL, 0x4080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000ULL, 0x2000000000ULL, 0x4000000000ULL, 0ULL, 0x1f0000000000ULL, 0x1e0000000000ULL, 0x1c0000000000ULL, 0x180000000000ULL, 0x100000000000ULL, 0ULL, 0x400000000000ULL, 0xc00000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000000ULL, 0x20000000000000ULL, 0x40000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810000000000000ULL, 0ULL, 0x2020000000000000ULL, 0ULL, 0x8040000000000000ULL},
-{0ULL, 0x2010080402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040ULL, 0ULL, 0ULL, 0ULL, 0x2010080400ULL, 0ULL, 0ULL, 0ULL, 0x4040404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010080000ULL, 0ULL, 0ULL, 0x4040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010000000ULL, 0ULL, 0x4040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000ULL, 0x4000000000ULL, 0x8000000000ULL, 0x3f0000000000ULL, 0x3e0000000000ULL, 0x3c0000000000ULL, 0x380000000000ULL, 0x300000000000ULL, 0x200000000000ULL, 0ULL, 0x800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000000000ULL, 0x40000000000000ULL, 0x80000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020000000000000ULL, 0ULL, 0x4040000000000000ULL, 0ULL},
-{0ULL, 0ULL, 0x4020100804ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080ULL, 0ULL, 0ULL, 0ULL, 0x4020100800ULL, 0ULL, 0ULL, 0ULL, 0x8080808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100000ULL, 0ULL, 0ULL, 0x8080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000000ULL, 0ULL, 0x8080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000000ULL, 0x8000000000ULL, 0x7f0000000000ULL, 0x7e0000000000ULL, 0x7c0000000000ULL, 0x780000000000ULL, 0x700000000000ULL, 0x600000000000ULL, 0x400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000000000000ULL, 0x80000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040000000000000ULL, 0ULL, 0x8080000000000000ULL},
-{0x10101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408102040ULL, 0ULL, 0x10101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408102000ULL, 0ULL, 0ULL, 0x10101010000ULL, 0ULL, 0ULL, 0ULL, 0x20408100000ULL, 0ULL, 0ULL, 0ULL, 0x10101000000ULL, 0ULL, 0ULL, 0x20408000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10100000000ULL, 0ULL, 0x20400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000ULL, 0x20000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000000ULL, 0x6000000000000ULL, 0xe000000000000ULL, 0x1e000000000000ULL, 0x3e000000000000ULL, 0x7e000000000000ULL, 0xfe000000000000ULL, 0x100000000000000ULL, 0x200000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x20202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40810204080ULL, 0ULL, 0x20202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40810204000ULL, 0ULL, 0ULL, 0x20202020000ULL, 0ULL, 0ULL, 0ULL, 0x40810200000ULL, 0ULL, 0ULL, 0ULL, 0x20202000000ULL, 0ULL, 0ULL, 0x40810000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20200000000ULL, 0ULL, 0x40800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000ULL, 0x20000000000ULL, 0x40000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000ULL, 0ULL, 0x4000000000000ULL, 0xc000000000000ULL, 0x1c000000000000ULL, 0x3c000000000000ULL, 0x7c000000000000ULL, 0xfc000000000000ULL, 0x100000000000000ULL, 0x200000000000000ULL, 0x400000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x40404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81020408000ULL, 0ULL, 0ULL, 0x40404040000ULL, 0ULL, 0ULL, 0ULL, 0x81020400000ULL, 0ULL, 0ULL, 0ULL, 0x40404000000ULL, 0ULL, 0ULL, 0x81020000000ULL, 0ULL, 0ULL, 0x20100000000ULL, 0ULL, 0x40400000000ULL, 0ULL, 0x81000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000000ULL, 0x40000000000ULL, 0x80000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x3000000000000ULL, 0x2000000000000ULL, 0ULL, 0x8000000000000ULL, 0x18000000000000ULL, 0x38000000000000ULL, 0x78000000000000ULL, 0xf8000000000000ULL, 0ULL, 0x200000000000000ULL, 0x400000000000000ULL, 0x800000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x80808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080000ULL, 0ULL, 0ULL, 0ULL, 0x102040800000ULL, 0x40201000000ULL, 0ULL, 0ULL, 0x80808000000ULL, 0ULL, 0ULL, 0x102040000000ULL, 0ULL, 0ULL, 0x40200000000ULL, 0ULL, 0x80800000000ULL, 0ULL, 0x102000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000000000ULL, 0x80000000000ULL, 0x100000000000ULL, 0ULL, 0ULL, 0ULL, 0x7000000000000ULL, 0x6000000000000ULL, 0x4000000000000ULL, 0ULL, 0x10000000000000ULL, 0x30000000000000ULL, 0x70000000000000ULL, 0xf0000000000000ULL, 0ULL, 0ULL, 0x400000000000000ULL, 0x800000000000000ULL, 0x1000000000000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x101010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010101000ULL, 0ULL, 0ULL, 0ULL, 0x80402010000ULL, 0ULL, 0ULL, 0ULL, 0x101010100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402000000ULL, 0ULL, 0ULL, 0x101010000000ULL, 0ULL, 0ULL, 0x204080000000ULL, 0ULL, 0ULL, 0x80400000000ULL, 0ULL, 0x101000000000ULL, 0ULL, 0x204000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000000000ULL, 0x100000000000ULL, 0x200000000000ULL, 0ULL, 0ULL, 0xf000000000000ULL, 0xe000000000000ULL, 0xc000000000000ULL, 0x8000000000000ULL, 0ULL, 0x20000000000000ULL, 0x60000000000000ULL, 0xe0000000000000ULL, 0ULL, 0ULL, 0ULL, 0x800000000000000ULL, 0x1000000000000000ULL, 0x2000000000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202020ULL, 0ULL, 0ULL, 0x100804020100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202000ULL, 0ULL, 0ULL, 0ULL, 0x100804020000ULL, 0ULL, 0ULL, 0ULL, 0x202020200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100804000000ULL, 0ULL, 0ULL, 0x202020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100800000000ULL, 0ULL, 0x202000000000ULL, 0ULL, 0x408000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000000ULL, 0x200000000000ULL, 0x400000000000ULL, 0ULL, 0x1f000000000000ULL, 0x1e000000000000ULL, 0x1c000000000000ULL, 0x18000000000000ULL, 0x10000000000000ULL, 0ULL, 0x40000000000000ULL, 0xc0000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000000ULL, 0x2000000000000000ULL, 0x4000000000000000ULL, 0ULL},
-{0x201008040201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040ULL, 0ULL, 0ULL, 0x201008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404000ULL, 0ULL, 0ULL, 0ULL, 0x201008040000ULL, 0ULL, 0ULL, 0ULL, 0x404040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201008000000ULL, 0ULL, 0ULL, 0x404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201000000000ULL, 0ULL, 0x404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000000ULL, 0x400000000000ULL, 0x800000000000ULL, 0x3f000000000000ULL, 0x3e000000000000ULL, 0x3c000000000000ULL, 0x38000000000000ULL, 0x30000000000000ULL, 0x20000000000000ULL, 0ULL, 0x80000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000000000ULL, 0x4000000000000000ULL, 0x8000000000000000ULL},
-{0ULL, 0x402010080402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080ULL, 0ULL, 0ULL, 0x402010080400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808000ULL, 0ULL, 0ULL, 0ULL, 0x402010080000ULL, 0ULL, 0ULL, 0ULL, 0x808080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010000000ULL, 0ULL, 0ULL, 0x808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402000000000ULL, 0ULL, 0x808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000000000ULL, 0x800000000000ULL, 0x7f000000000000ULL, 0x7e000000000000ULL, 0x7c000000000000ULL, 0x78000000000000ULL, 0x70000000000000ULL, 0x60000000000000ULL, 0x40000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000000000000ULL, 0x8000000000000000ULL},
-{0x1010101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040810204080ULL, 0x1010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040810204000ULL, 0ULL, 0x1010101010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040810200000ULL, 0ULL, 0ULL, 0x1010101000000ULL, 0ULL, 0ULL, 0ULL, 0x2040810000000ULL, 0ULL, 0ULL, 0ULL, 0x1010100000000ULL, 0ULL, 0ULL, 0x2040800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000000000ULL, 0ULL, 0x2040000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000ULL, 0x2000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000000000ULL, 0x600000000000000ULL, 0xe00000000000000ULL, 0x1e00000000000000ULL, 0x3e00000000000000ULL, 0x7e00000000000000ULL, 0xfe00000000000000ULL},
-{0ULL, 0x2020202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4081020408000ULL, 0ULL, 0x2020202020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4081020400000ULL, 0ULL, 0ULL, 0x2020202000000ULL, 0ULL, 0ULL, 0ULL, 0x4081020000000ULL, 0ULL, 0ULL, 0ULL, 0x2020200000000ULL, 0ULL, 0ULL, 0x4081000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020000000000ULL, 0ULL, 0x4080000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000ULL, 0x2000000000000ULL, 0x4000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000000000ULL, 0ULL, 0x400000000000000ULL, 0xc00000000000000ULL, 0x1c00000000000000ULL, 0x3c00000000000000ULL, 0x7c00000000000000ULL, 0xfc00000000000000ULL},
-{0ULL, 0ULL, 0x4040404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8102040800000ULL, 0ULL, 0ULL, 0x4040404000000ULL, 0ULL, 0ULL, 0ULL, 0x8102040000000ULL, 0ULL, 0ULL, 0ULL, 0x4040400000000ULL, 0ULL, 0ULL, 0x8102000000000ULL, 0ULL, 0ULL, 0x2010000000000ULL, 0ULL, 0x4040000000000ULL, 0ULL, 0x8100000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000000ULL, 0x4000000000000ULL, 0x8000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x300000000000000ULL, 0x200000000000000ULL, 0ULL, 0x800000000000000ULL, 0x1800000000000000ULL, 0x3800000000000000ULL, 0x7800000000000000ULL, 0xf800000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0x8080808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808000000ULL, 0ULL, 0ULL, 0ULL, 0x10204080000000ULL, 0x4020100000000ULL, 0ULL, 0ULL, 0x8080800000000ULL, 0ULL, 0ULL, 0x10204000000000ULL, 0ULL, 0ULL, 0x4020000000000ULL, 0ULL, 0x8080000000000ULL, 0ULL, 0x10200000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000000000ULL, 0x8000000000000ULL, 0x10000000000000ULL, 0ULL, 0ULL, 0ULL, 0x700000000000000ULL, 0x600000000000000ULL, 0x400000000000000ULL, 0ULL, 0x1000000000000000ULL, 0x3000000000000000ULL, 0x7000000000000000ULL, 0xf000000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010100000ULL, 0ULL, 0ULL, 0ULL, 0x8040201000000ULL, 0ULL, 0ULL, 0ULL, 0x10101010000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200000000ULL, 0ULL, 0ULL, 0x10101000000000ULL, 0ULL, 0ULL, 0x20408000000000ULL, 0ULL, 0ULL, 0x8040000000000ULL, 0ULL, 0x10100000000000ULL, 0ULL, 0x20400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000000000000ULL, 0x10000000000000ULL, 0x20000000000000ULL, 0ULL, 0ULL, 0xf00000000000000ULL, 0xe00000000000000ULL, 0xc00000000000000ULL, 0x800000000000000ULL, 0ULL, 0x2000000000000000ULL, 0x6000000000000000ULL, 0xe000000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202000ULL, 0ULL, 0ULL, 0x10080402010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020200000ULL, 0ULL, 0ULL, 0ULL, 0x10080402000000ULL, 0ULL, 0ULL, 0ULL, 0x20202020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080400000000ULL, 0ULL, 0ULL, 0x20202000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080000000000ULL, 0ULL, 0x20200000000000ULL, 0ULL, 0x40800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000000ULL, 0x20000000000000ULL, 0x40000000000000ULL, 0ULL, 0x1f00000000000000ULL, 0x1e00000000000000ULL, 0x1c00000000000000ULL, 0x1800000000000000ULL, 0x1000000000000000ULL, 0ULL, 0x4000000000000000ULL, 0xc000000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404040ULL, 0ULL, 0x20100804020100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404000ULL, 0ULL, 0ULL, 0x20100804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040400000ULL, 0ULL, 0ULL, 0ULL, 0x20100804000000ULL, 0ULL, 0ULL, 0ULL, 0x40404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100800000000ULL, 0ULL, 0ULL, 0x40404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100000000000ULL, 0ULL, 0x40400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20000000000000ULL, 0x40000000000000ULL, 0x80000000000000ULL, 0x3f00000000000000ULL, 0x3e00000000000000ULL, 0x3c00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL, 0x2000000000000000ULL, 0ULL, 0x8000000000000000ULL},
-{0x40201008040201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808080ULL, 0ULL, 0x40201008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808000ULL, 0ULL, 0ULL, 0x40201008040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080800000ULL, 0ULL, 0ULL, 0ULL, 0x40201008000000ULL, 0ULL, 0ULL, 0ULL, 0x80808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201000000000ULL, 0ULL, 0ULL, 0x80808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40200000000000ULL, 0ULL, 0x80800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40000000000000ULL, 0x80000000000000ULL, 0x7f00000000000000ULL, 0x7e00000000000000ULL, 0x7c00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL, 0x6000000000000000ULL, 0x4000000000000000ULL, 0ULL}};
-
-// Path from Enemy to including King + square behind king + excluding enemy
-uint64_t CheckBetween[64][64] = {{0ULL, 0x1ULL, 0x3ULL, 0x7ULL, 0xfULL, 0x1fULL, 0x3fULL, 0x7fULL, 0x1ULL, 0x1ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101ULL, 0ULL, 0x201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101ULL, 0ULL, 0ULL, 0x40201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101ULL, 0ULL, 0ULL, 0ULL, 0x8040201ULL, 0ULL, 0ULL, 0ULL, 0x101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008040201ULL, 0ULL, 0ULL, 0x10101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201008040201ULL, 0ULL, 0x1010101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008040201ULL},
-{0x6ULL, 0ULL, 0x3ULL, 0x7ULL, 0xfULL, 0x1fULL, 0x3fULL, 0x7fULL, 0x2ULL, 0x2ULL, 0x2ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202ULL, 0ULL, 0x402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202ULL, 0ULL, 0ULL, 0x80402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202ULL, 0ULL, 0ULL, 0ULL, 0x10080402ULL, 0ULL, 0ULL, 0ULL, 0x202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010080402ULL, 0ULL, 0ULL, 0x20202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010080402ULL, 0ULL, 0x2020202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0xeULL, 0xcULL, 0ULL, 0x6ULL, 0xeULL, 0x1eULL, 0x3eULL, 0x7eULL, 0ULL, 0x4ULL, 0x4ULL, 0x4ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204ULL, 0ULL, 0x404ULL, 0ULL, 0x804ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404ULL, 0ULL, 0ULL, 0x100804ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404ULL, 0ULL, 0ULL, 0ULL, 0x20100804ULL, 0ULL, 0ULL, 0ULL, 0x404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100804ULL, 0ULL, 0ULL, 0x40404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0x1eULL, 0x1cULL, 0x18ULL, 0ULL, 0xcULL, 0x1cULL, 0x3cULL, 0x7cULL, 0ULL, 0ULL, 0x8ULL, 0x8ULL, 0x8ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408ULL, 0ULL, 0x808ULL, 0ULL, 0x1008ULL, 0ULL, 0ULL, 0x20408ULL, 0ULL, 0ULL, 0x80808ULL, 0ULL, 0ULL, 0x201008ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808ULL, 0ULL, 0ULL, 0ULL, 0x40201008ULL, 0ULL, 0ULL, 0ULL, 0x808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0x3eULL, 0x3cULL, 0x38ULL, 0x30ULL, 0ULL, 0x18ULL, 0x38ULL, 0x78ULL, 0ULL, 0ULL, 0ULL, 0x10ULL, 0x10ULL, 0x10ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810ULL, 0ULL, 0x1010ULL, 0ULL, 0x2010ULL, 0ULL, 0ULL, 0x40810ULL, 0ULL, 0ULL, 0x101010ULL, 0ULL, 0ULL, 0x402010ULL, 0x2040810ULL, 0ULL, 0ULL, 0ULL, 0x10101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101010ULL, 0ULL, 0ULL, 0ULL},
-{0x7eULL, 0x7cULL, 0x78ULL, 0x70ULL, 0x60ULL, 0ULL, 0x30ULL, 0x70ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20ULL, 0x20ULL, 0x20ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020ULL, 0ULL, 0x2020ULL, 0ULL, 0x4020ULL, 0ULL, 0ULL, 0x81020ULL, 0ULL, 0ULL, 0x202020ULL, 0ULL, 0ULL, 0ULL, 0x4081020ULL, 0ULL, 0ULL, 0ULL, 0x20202020ULL, 0ULL, 0ULL, 0x204081020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202020ULL, 0ULL, 0ULL},
-{0xfeULL, 0xfcULL, 0xf8ULL, 0xf0ULL, 0xe0ULL, 0xc0ULL, 0ULL, 0x60ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40ULL, 0x40ULL, 0x40ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040ULL, 0ULL, 0x4040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040ULL, 0ULL, 0ULL, 0x404040ULL, 0ULL, 0ULL, 0ULL, 0x8102040ULL, 0ULL, 0ULL, 0ULL, 0x40404040ULL, 0ULL, 0ULL, 0x408102040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040ULL, 0ULL, 0x20408102040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404040ULL, 0ULL},
-{0xfeULL, 0xfcULL, 0xf8ULL, 0xf0ULL, 0xe0ULL, 0xc0ULL, 0x80ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80ULL, 0x80ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080ULL, 0ULL, 0x8080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204080ULL, 0ULL, 0ULL, 0x808080ULL, 0ULL, 0ULL, 0ULL, 0x10204080ULL, 0ULL, 0ULL, 0ULL, 0x80808080ULL, 0ULL, 0ULL, 0x810204080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080ULL, 0ULL, 0x40810204080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080ULL, 0x2040810204080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808080ULL},
-{0x10100ULL, 0x100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100ULL, 0x300ULL, 0x700ULL, 0xf00ULL, 0x1f00ULL, 0x3f00ULL, 0x7f00ULL, 0x101ULL, 0x100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101ULL, 0ULL, 0x20100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101ULL, 0ULL, 0ULL, 0x4020100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010101ULL, 0ULL, 0ULL, 0ULL, 0x804020100ULL, 0ULL, 0ULL, 0ULL, 0x10101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100804020100ULL, 0ULL, 0ULL, 0x1010101010101ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100804020100ULL, 0ULL},
-{0x40200ULL, 0x20200ULL, 0x10200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x600ULL, 0ULL, 0x300ULL, 0x700ULL, 0xf00ULL, 0x1f00ULL, 0x3f00ULL, 0x7f00ULL, 0x204ULL, 0x202ULL, 0x201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202ULL, 0ULL, 0x40201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202ULL, 0ULL, 0ULL, 0x8040201ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202ULL, 0ULL, 0ULL, 0ULL, 0x1008040201ULL, 0ULL, 0ULL, 0ULL, 0x20202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201008040201ULL, 0ULL, 0ULL, 0x2020202020202ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008040201ULL},
-{0ULL, 0x80400ULL, 0x40400ULL, 0x20400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe00ULL, 0xc00ULL, 0ULL, 0x600ULL, 0xe00ULL, 0x1e00ULL, 0x3e00ULL, 0x7e00ULL, 0ULL, 0x408ULL, 0x404ULL, 0x402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408ULL, 0ULL, 0x40404ULL, 0ULL, 0x80402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404ULL, 0ULL, 0ULL, 0x10080402ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404ULL, 0ULL, 0ULL, 0ULL, 0x2010080402ULL, 0ULL, 0ULL, 0ULL, 0x40404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010080402ULL, 0ULL, 0ULL, 0x4040404040404ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x100800ULL, 0x80800ULL, 0x40800ULL, 0ULL, 0ULL, 0ULL, 0x1e00ULL, 0x1c00ULL, 0x1800ULL, 0ULL, 0xc00ULL, 0x1c00ULL, 0x3c00ULL, 0x7c00ULL, 0ULL, 0ULL, 0x810ULL, 0x808ULL, 0x804ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40810ULL, 0ULL, 0x80808ULL, 0ULL, 0x100804ULL, 0ULL, 0ULL, 0x2040810ULL, 0ULL, 0ULL, 0x8080808ULL, 0ULL, 0ULL, 0x20100804ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808ULL, 0ULL, 0ULL, 0ULL, 0x4020100804ULL, 0ULL, 0ULL, 0ULL, 0x80808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080808ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x201000ULL, 0x101000ULL, 0x81000ULL, 0ULL, 0ULL, 0x3e00ULL, 0x3c00ULL, 0x3800ULL, 0x3000ULL, 0ULL, 0x1800ULL, 0x3800ULL, 0x7800ULL, 0ULL, 0ULL, 0ULL, 0x1020ULL, 0x1010ULL, 0x1008ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81020ULL, 0ULL, 0x101010ULL, 0ULL, 0x201008ULL, 0ULL, 0ULL, 0x4081020ULL, 0ULL, 0ULL, 0x10101010ULL, 0ULL, 0ULL, 0x40201008ULL, 0x204081020ULL, 0ULL, 0ULL, 0ULL, 0x1010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010101010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101010ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x402000ULL, 0x202000ULL, 0x102000ULL, 0ULL, 0x7e00ULL, 0x7c00ULL, 0x7800ULL, 0x7000ULL, 0x6000ULL, 0ULL, 0x3000ULL, 0x7000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040ULL, 0x2020ULL, 0x2010ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040ULL, 0ULL, 0x202020ULL, 0ULL, 0x402010ULL, 0ULL, 0ULL, 0x8102040ULL, 0ULL, 0ULL, 0x20202020ULL, 0ULL, 0ULL, 0ULL, 0x408102040ULL, 0ULL, 0ULL, 0ULL, 0x2020202020ULL, 0ULL, 0ULL, 0x20408102040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202020ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000ULL, 0x404000ULL, 0x204000ULL, 0xfe00ULL, 0xfc00ULL, 0xf800ULL, 0xf000ULL, 0xe000ULL, 0xc000ULL, 0ULL, 0x6000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080ULL, 0x4040ULL, 0x4020ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204080ULL, 0ULL, 0x404040ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204080ULL, 0ULL, 0ULL, 0x40404040ULL, 0ULL, 0ULL, 0ULL, 0x810204080ULL, 0ULL, 0ULL, 0ULL, 0x4040404040ULL, 0ULL, 0ULL, 0x40810204080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040ULL, 0ULL, 0x2040810204080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404040ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000ULL, 0x808000ULL, 0xfe00ULL, 0xfc00ULL, 0xf800ULL, 0xf000ULL, 0xe000ULL, 0xc000ULL, 0x8000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000ULL, 0x8080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000ULL, 0ULL, 0x808080ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408000ULL, 0ULL, 0ULL, 0x80808080ULL, 0ULL, 0ULL, 0ULL, 0x1020408000ULL, 0ULL, 0ULL, 0ULL, 0x8080808080ULL, 0ULL, 0ULL, 0x81020408000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080ULL, 0ULL, 0x4081020408000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808080ULL},
-{0x1010100ULL, 0ULL, 0x10200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000ULL, 0x10000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000ULL, 0x30000ULL, 0x70000ULL, 0xf0000ULL, 0x1f0000ULL, 0x3f0000ULL, 0x7f0000ULL, 0x10100ULL, 0x10000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010100ULL, 0ULL, 0x2010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010100ULL, 0ULL, 0ULL, 0x402010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010100ULL, 0ULL, 0ULL, 0ULL, 0x80402010000ULL, 0ULL, 0ULL, 0ULL, 0x1010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080402010000ULL, 0ULL, 0ULL},
-{0ULL, 0x2020200ULL, 0ULL, 0x1020400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000ULL, 0x2020000ULL, 0x1020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x60000ULL, 0ULL, 0x30000ULL, 0x70000ULL, 0xf0000ULL, 0x1f0000ULL, 0x3f0000ULL, 0x7f0000ULL, 0x20400ULL, 0x20200ULL, 0x20100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020200ULL, 0ULL, 0x4020100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020200ULL, 0ULL, 0ULL, 0x804020100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020200ULL, 0ULL, 0ULL, 0ULL, 0x100804020100ULL, 0ULL, 0ULL, 0ULL, 0x2020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100804020100ULL, 0ULL},
-{0x8040200ULL, 0ULL, 0x4040400ULL, 0ULL, 0x2040800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000ULL, 0x4040000ULL, 0x2040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe0000ULL, 0xc0000ULL, 0ULL, 0x60000ULL, 0xe0000ULL, 0x1e0000ULL, 0x3e0000ULL, 0x7e0000ULL, 0ULL, 0x40800ULL, 0x40400ULL, 0x40200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040800ULL, 0ULL, 0x4040400ULL, 0ULL, 0x8040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040400ULL, 0ULL, 0ULL, 0x1008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040400ULL, 0ULL, 0ULL, 0ULL, 0x201008040200ULL, 0ULL, 0ULL, 0ULL, 0x4040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008040200ULL},
-{0ULL, 0x10080400ULL, 0ULL, 0x8080800ULL, 0ULL, 0x4081000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080000ULL, 0x8080000ULL, 0x4080000ULL, 0ULL, 0ULL, 0ULL, 0x1e0000ULL, 0x1c0000ULL, 0x180000ULL, 0ULL, 0xc0000ULL, 0x1c0000ULL, 0x3c0000ULL, 0x7c0000ULL, 0ULL, 0ULL, 0x81000ULL, 0x80800ULL, 0x80400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4081000ULL, 0ULL, 0x8080800ULL, 0ULL, 0x10080400ULL, 0ULL, 0ULL, 0x204081000ULL, 0ULL, 0ULL, 0x808080800ULL, 0ULL, 0ULL, 0x2010080400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080800ULL, 0ULL, 0ULL, 0ULL, 0x402010080400ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x20100800ULL, 0ULL, 0x10101000ULL, 0ULL, 0x8102000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100000ULL, 0x10100000ULL, 0x8100000ULL, 0ULL, 0ULL, 0x3e0000ULL, 0x3c0000ULL, 0x380000ULL, 0x300000ULL, 0ULL, 0x180000ULL, 0x380000ULL, 0x780000ULL, 0ULL, 0ULL, 0ULL, 0x102000ULL, 0x101000ULL, 0x100800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8102000ULL, 0ULL, 0x10101000ULL, 0ULL, 0x20100800ULL, 0ULL, 0ULL, 0x408102000ULL, 0ULL, 0ULL, 0x1010101000ULL, 0ULL, 0ULL, 0x4020100800ULL, 0x20408102000ULL, 0ULL, 0ULL, 0ULL, 0x101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x40201000ULL, 0ULL, 0x20202000ULL, 0ULL, 0x10204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40200000ULL, 0x20200000ULL, 0x10200000ULL, 0ULL, 0x7e0000ULL, 0x7c0000ULL, 0x780000ULL, 0x700000ULL, 0x600000ULL, 0ULL, 0x300000ULL, 0x700000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000ULL, 0x202000ULL, 0x201000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204000ULL, 0ULL, 0x20202000ULL, 0ULL, 0x40201000ULL, 0ULL, 0ULL, 0x810204000ULL, 0ULL, 0ULL, 0x2020202000ULL, 0ULL, 0ULL, 0ULL, 0x40810204000ULL, 0ULL, 0ULL, 0ULL, 0x202020202000ULL, 0ULL, 0ULL, 0x2040810204000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x80402000ULL, 0ULL, 0x40404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80400000ULL, 0x40400000ULL, 0x20400000ULL, 0xfe0000ULL, 0xfc0000ULL, 0xf80000ULL, 0xf00000ULL, 0xe00000ULL, 0xc00000ULL, 0ULL, 0x600000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000ULL, 0x404000ULL, 0x402000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408000ULL, 0ULL, 0x40404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020408000ULL, 0ULL, 0ULL, 0x4040404000ULL, 0ULL, 0ULL, 0ULL, 0x81020408000ULL, 0ULL, 0ULL, 0ULL, 0x404040404000ULL, 0ULL, 0ULL, 0x4081020408000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000ULL, 0ULL, 0x80808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000ULL, 0x80800000ULL, 0xfe0000ULL, 0xfc0000ULL, 0xf80000ULL, 0xf00000ULL, 0xe00000ULL, 0xc00000ULL, 0x800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000ULL, 0x808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800000ULL, 0ULL, 0x80808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040800000ULL, 0ULL, 0ULL, 0x8080808000ULL, 0ULL, 0ULL, 0ULL, 0x102040800000ULL, 0ULL, 0ULL, 0ULL, 0x808080808000ULL, 0ULL, 0ULL, 0x8102040800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808000ULL},
-{0x101010100ULL, 0ULL, 0ULL, 0x1020400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010000ULL, 0ULL, 0x1020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000ULL, 0x1000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000ULL, 0x3000000ULL, 0x7000000ULL, 0xf000000ULL, 0x1f000000ULL, 0x3f000000ULL, 0x7f000000ULL, 0x1010000ULL, 0x1000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010000ULL, 0ULL, 0x201000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101010000ULL, 0ULL, 0ULL, 0x40201000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010000ULL, 0ULL, 0ULL, 0ULL, 0x8040201000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x202020200ULL, 0ULL, 0ULL, 0x102040800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020000ULL, 0ULL, 0x102040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402000000ULL, 0x202000000ULL, 0x102000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x6000000ULL, 0ULL, 0x3000000ULL, 0x7000000ULL, 0xf000000ULL, 0x1f000000ULL, 0x3f000000ULL, 0x7f000000ULL, 0x2040000ULL, 0x2020000ULL, 0x2010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020000ULL, 0ULL, 0x402010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020000ULL, 0ULL, 0ULL, 0x80402010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020000ULL, 0ULL, 0ULL, 0ULL, 0x10080402010000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x404040400ULL, 0ULL, 0ULL, 0x204081000ULL, 0ULL, 0ULL, 0x804020000ULL, 0ULL, 0x404040000ULL, 0ULL, 0x204080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000000ULL, 0x404000000ULL, 0x204000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe000000ULL, 0xc000000ULL, 0ULL, 0x6000000ULL, 0xe000000ULL, 0x1e000000ULL, 0x3e000000ULL, 0x7e000000ULL, 0ULL, 0x4080000ULL, 0x4040000ULL, 0x4020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204080000ULL, 0ULL, 0x404040000ULL, 0ULL, 0x804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040000ULL, 0ULL, 0ULL, 0x100804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000ULL, 0ULL, 0ULL, 0ULL, 0x20100804020000ULL, 0ULL},
-{0x1008040200ULL, 0ULL, 0ULL, 0x808080800ULL, 0ULL, 0ULL, 0x408102000ULL, 0ULL, 0ULL, 0x1008040000ULL, 0ULL, 0x808080000ULL, 0ULL, 0x408100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008000000ULL, 0x808000000ULL, 0x408000000ULL, 0ULL, 0ULL, 0ULL, 0x1e000000ULL, 0x1c000000ULL, 0x18000000ULL, 0ULL, 0xc000000ULL, 0x1c000000ULL, 0x3c000000ULL, 0x7c000000ULL, 0ULL, 0ULL, 0x8100000ULL, 0x8080000ULL, 0x8040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408100000ULL, 0ULL, 0x808080000ULL, 0ULL, 0x1008040000ULL, 0ULL, 0ULL, 0x20408100000ULL, 0ULL, 0ULL, 0x80808080000ULL, 0ULL, 0ULL, 0x201008040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000ULL, 0ULL, 0ULL, 0ULL, 0x40201008040000ULL},
-{0ULL, 0x2010080400ULL, 0ULL, 0ULL, 0x1010101000ULL, 0ULL, 0ULL, 0x810204000ULL, 0ULL, 0ULL, 0x2010080000ULL, 0ULL, 0x1010100000ULL, 0ULL, 0x810200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010000000ULL, 0x1010000000ULL, 0x810000000ULL, 0ULL, 0ULL, 0x3e000000ULL, 0x3c000000ULL, 0x38000000ULL, 0x30000000ULL, 0ULL, 0x18000000ULL, 0x38000000ULL, 0x78000000ULL, 0ULL, 0ULL, 0ULL, 0x10200000ULL, 0x10100000ULL, 0x10080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x810200000ULL, 0ULL, 0x1010100000ULL, 0ULL, 0x2010080000ULL, 0ULL, 0ULL, 0x40810200000ULL, 0ULL, 0ULL, 0x101010100000ULL, 0ULL, 0ULL, 0x402010080000ULL, 0x2040810200000ULL, 0ULL, 0ULL, 0ULL, 0x10101010100000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x4020100800ULL, 0ULL, 0ULL, 0x2020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100000ULL, 0ULL, 0x2020200000ULL, 0ULL, 0x1020400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000000ULL, 0x2020000000ULL, 0x1020000000ULL, 0ULL, 0x7e000000ULL, 0x7c000000ULL, 0x78000000ULL, 0x70000000ULL, 0x60000000ULL, 0ULL, 0x30000000ULL, 0x70000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400000ULL, 0x20200000ULL, 0x20100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020400000ULL, 0ULL, 0x2020200000ULL, 0ULL, 0x4020100000ULL, 0ULL, 0ULL, 0x81020400000ULL, 0ULL, 0ULL, 0x202020200000ULL, 0ULL, 0ULL, 0ULL, 0x4081020400000ULL, 0ULL, 0ULL, 0ULL, 0x20202020200000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x8040201000ULL, 0ULL, 0ULL, 0x4040404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200000ULL, 0ULL, 0x4040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000000ULL, 0x4040000000ULL, 0x2040000000ULL, 0xfe000000ULL, 0xfc000000ULL, 0xf8000000ULL, 0xf0000000ULL, 0xe0000000ULL, 0xc0000000ULL, 0ULL, 0x60000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800000ULL, 0x40400000ULL, 0x40200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040800000ULL, 0ULL, 0x4040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040800000ULL, 0ULL, 0ULL, 0x404040400000ULL, 0ULL, 0ULL, 0ULL, 0x8102040800000ULL, 0ULL, 0ULL, 0ULL, 0x40404040400000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x80402000ULL, 0ULL, 0ULL, 0x8080808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80400000ULL, 0ULL, 0x8080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000000ULL, 0x8080000000ULL, 0xfe000000ULL, 0xfc000000ULL, 0xf8000000ULL, 0xf0000000ULL, 0xe0000000ULL, 0xc0000000ULL, 0x80000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000000ULL, 0x80800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080000000ULL, 0ULL, 0x8080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204080000000ULL, 0ULL, 0ULL, 0x808080800000ULL, 0ULL, 0ULL, 0ULL, 0x10204080000000ULL, 0ULL, 0ULL, 0ULL, 0x80808080800000ULL},
-{0x10101010100ULL, 0ULL, 0ULL, 0ULL, 0x102040800ULL, 0ULL, 0ULL, 0ULL, 0x10101010000ULL, 0ULL, 0ULL, 0x102040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101000000ULL, 0ULL, 0x102000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10100000000ULL, 0x100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000ULL, 0x300000000ULL, 0x700000000ULL, 0xf00000000ULL, 0x1f00000000ULL, 0x3f00000000ULL, 0x7f00000000ULL, 0x101000000ULL, 0x100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10101000000ULL, 0ULL, 0x20100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101000000ULL, 0ULL, 0ULL, 0x4020100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x20202020200ULL, 0ULL, 0ULL, 0ULL, 0x10204081000ULL, 0ULL, 0ULL, 0ULL, 0x20202020000ULL, 0ULL, 0ULL, 0x10204080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202000000ULL, 0ULL, 0x10204000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40200000000ULL, 0x20200000000ULL, 0x10200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x600000000ULL, 0ULL, 0x300000000ULL, 0x700000000ULL, 0xf00000000ULL, 0x1f00000000ULL, 0x3f00000000ULL, 0x7f00000000ULL, 0x204000000ULL, 0x202000000ULL, 0x201000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202000000ULL, 0ULL, 0x40201000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202000000ULL, 0ULL, 0ULL, 0x8040201000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x40404040400ULL, 0ULL, 0ULL, 0ULL, 0x20408102000ULL, 0ULL, 0ULL, 0ULL, 0x40404040000ULL, 0ULL, 0ULL, 0x20408100000ULL, 0ULL, 0ULL, 0x80402000000ULL, 0ULL, 0x40404000000ULL, 0ULL, 0x20408000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80400000000ULL, 0x40400000000ULL, 0x20400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe00000000ULL, 0xc00000000ULL, 0ULL, 0x600000000ULL, 0xe00000000ULL, 0x1e00000000ULL, 0x3e00000000ULL, 0x7e00000000ULL, 0ULL, 0x408000000ULL, 0x404000000ULL, 0x402000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408000000ULL, 0ULL, 0x40404000000ULL, 0ULL, 0x80402000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404000000ULL, 0ULL, 0ULL, 0x10080402000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x80808080800ULL, 0ULL, 0ULL, 0ULL, 0x40810204000ULL, 0x100804020000ULL, 0ULL, 0ULL, 0x80808080000ULL, 0ULL, 0ULL, 0x40810200000ULL, 0ULL, 0ULL, 0x100804000000ULL, 0ULL, 0x80808000000ULL, 0ULL, 0x40810000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100800000000ULL, 0x80800000000ULL, 0x40800000000ULL, 0ULL, 0ULL, 0ULL, 0x1e00000000ULL, 0x1c00000000ULL, 0x1800000000ULL, 0ULL, 0xc00000000ULL, 0x1c00000000ULL, 0x3c00000000ULL, 0x7c00000000ULL, 0ULL, 0ULL, 0x810000000ULL, 0x808000000ULL, 0x804000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40810000000ULL, 0ULL, 0x80808000000ULL, 0ULL, 0x100804000000ULL, 0ULL, 0ULL, 0x2040810000000ULL, 0ULL, 0ULL, 0x8080808000000ULL, 0ULL, 0ULL, 0x20100804000000ULL, 0ULL},
-{0x201008040200ULL, 0ULL, 0ULL, 0ULL, 0x101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201008040000ULL, 0ULL, 0ULL, 0x101010100000ULL, 0ULL, 0ULL, 0x81020400000ULL, 0ULL, 0ULL, 0x201008000000ULL, 0ULL, 0x101010000000ULL, 0ULL, 0x81020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x201000000000ULL, 0x101000000000ULL, 0x81000000000ULL, 0ULL, 0ULL, 0x3e00000000ULL, 0x3c00000000ULL, 0x3800000000ULL, 0x3000000000ULL, 0ULL, 0x1800000000ULL, 0x3800000000ULL, 0x7800000000ULL, 0ULL, 0ULL, 0ULL, 0x1020000000ULL, 0x1010000000ULL, 0x1008000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x81020000000ULL, 0ULL, 0x101010000000ULL, 0ULL, 0x201008000000ULL, 0ULL, 0ULL, 0x4081020000000ULL, 0ULL, 0ULL, 0x10101010000000ULL, 0ULL, 0ULL, 0x40201008000000ULL},
-{0ULL, 0x402010080400ULL, 0ULL, 0ULL, 0ULL, 0x202020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010080000ULL, 0ULL, 0ULL, 0x202020200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402010000000ULL, 0ULL, 0x202020000000ULL, 0ULL, 0x102040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402000000000ULL, 0x202000000000ULL, 0x102000000000ULL, 0ULL, 0x7e00000000ULL, 0x7c00000000ULL, 0x7800000000ULL, 0x7000000000ULL, 0x6000000000ULL, 0ULL, 0x3000000000ULL, 0x7000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040000000ULL, 0x2020000000ULL, 0x2010000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040000000ULL, 0ULL, 0x202020000000ULL, 0ULL, 0x402010000000ULL, 0ULL, 0ULL, 0x8102040000000ULL, 0ULL, 0ULL, 0x20202020000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x804020100800ULL, 0ULL, 0ULL, 0ULL, 0x404040404000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804020100000ULL, 0ULL, 0ULL, 0x404040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804020000000ULL, 0ULL, 0x404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000000000ULL, 0x404000000000ULL, 0x204000000000ULL, 0xfe00000000ULL, 0xfc00000000ULL, 0xf800000000ULL, 0xf000000000ULL, 0xe000000000ULL, 0xc000000000ULL, 0ULL, 0x6000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4080000000ULL, 0x4040000000ULL, 0x4020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204080000000ULL, 0ULL, 0x404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204080000000ULL, 0ULL, 0ULL, 0x40404040000000ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x8040201000ULL, 0ULL, 0ULL, 0ULL, 0x808080808000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200000ULL, 0ULL, 0ULL, 0x808080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000000ULL, 0ULL, 0x808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000000000ULL, 0x808000000000ULL, 0xfe00000000ULL, 0xfc00000000ULL, 0xf800000000ULL, 0xf000000000ULL, 0xe000000000ULL, 0xc000000000ULL, 0x8000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000000000ULL, 0x8080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000000000ULL, 0ULL, 0x808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408000000000ULL, 0ULL, 0ULL, 0x80808080000000ULL},
-{0x1010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204081000ULL, 0ULL, 0ULL, 0x1010101010000ULL, 0ULL, 0ULL, 0ULL, 0x10204080000ULL, 0ULL, 0ULL, 0ULL, 0x1010101000000ULL, 0ULL, 0ULL, 0x10204000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010100000000ULL, 0ULL, 0x10200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010000000000ULL, 0x10000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10000000000ULL, 0x30000000000ULL, 0x70000000000ULL, 0xf0000000000ULL, 0x1f0000000000ULL, 0x3f0000000000ULL, 0x7f0000000000ULL, 0x10100000000ULL, 0x10000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010100000000ULL, 0ULL, 0x2010000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x2020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020408102000ULL, 0ULL, 0ULL, 0x2020202020000ULL, 0ULL, 0ULL, 0ULL, 0x1020408100000ULL, 0ULL, 0ULL, 0ULL, 0x2020202000000ULL, 0ULL, 0ULL, 0x1020408000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020200000000ULL, 0ULL, 0x1020400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000000000ULL, 0x2020000000000ULL, 0x1020000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x60000000000ULL, 0ULL, 0x30000000000ULL, 0x70000000000ULL, 0xf0000000000ULL, 0x1f0000000000ULL, 0x3f0000000000ULL, 0x7f0000000000ULL, 0x20400000000ULL, 0x20200000000ULL, 0x20100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020200000000ULL, 0ULL, 0x4020100000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x4040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040810204000ULL, 0ULL, 0ULL, 0x4040404040000ULL, 0ULL, 0ULL, 0ULL, 0x2040810200000ULL, 0ULL, 0ULL, 0ULL, 0x4040404000000ULL, 0ULL, 0ULL, 0x2040810000000ULL, 0ULL, 0ULL, 0x8040200000000ULL, 0ULL, 0x4040400000000ULL, 0ULL, 0x2040800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000000000ULL, 0x4040000000000ULL, 0x2040000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe0000000000ULL, 0xc0000000000ULL, 0ULL, 0x60000000000ULL, 0xe0000000000ULL, 0x1e0000000000ULL, 0x3e0000000000ULL, 0x7e0000000000ULL, 0ULL, 0x40800000000ULL, 0x40400000000ULL, 0x40200000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2040800000000ULL, 0ULL, 0x4040400000000ULL, 0ULL, 0x8040200000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x8080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000ULL, 0ULL, 0ULL, 0ULL, 0x4081020400000ULL, 0x10080402000000ULL, 0ULL, 0ULL, 0x8080808000000ULL, 0ULL, 0ULL, 0x4081020000000ULL, 0ULL, 0ULL, 0x10080400000000ULL, 0ULL, 0x8080800000000ULL, 0ULL, 0x4081000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10080000000000ULL, 0x8080000000000ULL, 0x4080000000000ULL, 0ULL, 0ULL, 0ULL, 0x1e0000000000ULL, 0x1c0000000000ULL, 0x180000000000ULL, 0ULL, 0xc0000000000ULL, 0x1c0000000000ULL, 0x3c0000000000ULL, 0x7c0000000000ULL, 0ULL, 0ULL, 0x81000000000ULL, 0x80800000000ULL, 0x80400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4081000000000ULL, 0ULL, 0x8080800000000ULL, 0ULL, 0x10080400000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x10101010101000ULL, 0ULL, 0ULL, 0ULL, 0x20100804020000ULL, 0ULL, 0ULL, 0ULL, 0x10101010100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100804000000ULL, 0ULL, 0ULL, 0x10101010000000ULL, 0ULL, 0ULL, 0x8102040000000ULL, 0ULL, 0ULL, 0x20100800000000ULL, 0ULL, 0x10101000000000ULL, 0ULL, 0x8102000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20100000000000ULL, 0x10100000000000ULL, 0x8100000000000ULL, 0ULL, 0ULL, 0x3e0000000000ULL, 0x3c0000000000ULL, 0x380000000000ULL, 0x300000000000ULL, 0ULL, 0x180000000000ULL, 0x380000000000ULL, 0x780000000000ULL, 0ULL, 0ULL, 0ULL, 0x102000000000ULL, 0x101000000000ULL, 0x100800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8102000000000ULL, 0ULL, 0x10101000000000ULL, 0ULL, 0x20100800000000ULL, 0ULL},
-{0x40201008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20202020202000ULL, 0ULL, 0ULL, 0ULL, 0x40201008040000ULL, 0ULL, 0ULL, 0ULL, 0x20202020200000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201008000000ULL, 0ULL, 0ULL, 0x20202020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40201000000000ULL, 0ULL, 0x20202000000000ULL, 0ULL, 0x10204000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40200000000000ULL, 0x20200000000000ULL, 0x10200000000000ULL, 0ULL, 0x7e0000000000ULL, 0x7c0000000000ULL, 0x780000000000ULL, 0x700000000000ULL, 0x600000000000ULL, 0ULL, 0x300000000000ULL, 0x700000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204000000000ULL, 0x202000000000ULL, 0x201000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x10204000000000ULL, 0ULL, 0x20202000000000ULL, 0ULL, 0x40201000000000ULL},
-{0ULL, 0x80402010080400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40404040404000ULL, 0ULL, 0ULL, 0ULL, 0x80402010080000ULL, 0ULL, 0ULL, 0ULL, 0x40404040400000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402010000000ULL, 0ULL, 0ULL, 0x40404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402000000000ULL, 0ULL, 0x40404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80400000000000ULL, 0x40400000000000ULL, 0x20400000000000ULL, 0xfe0000000000ULL, 0xfc0000000000ULL, 0xf80000000000ULL, 0xf00000000000ULL, 0xe00000000000ULL, 0xc00000000000ULL, 0ULL, 0x600000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408000000000ULL, 0x404000000000ULL, 0x402000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20408000000000ULL, 0ULL, 0x40404000000000ULL, 0ULL},
-{0ULL, 0ULL, 0x804020100800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80808080808000ULL, 0ULL, 0ULL, 0ULL, 0x804020100000ULL, 0ULL, 0ULL, 0ULL, 0x80808080800000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804020000000ULL, 0ULL, 0ULL, 0x80808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000000000ULL, 0ULL, 0x80808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000000000ULL, 0x80800000000000ULL, 0xfe0000000000ULL, 0xfc0000000000ULL, 0xf80000000000ULL, 0xf00000000000ULL, 0xe00000000000ULL, 0xc00000000000ULL, 0x800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000000000ULL, 0x808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800000000000ULL, 0ULL, 0x80808000000000ULL},
-{0x101010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020408102000ULL, 0ULL, 0x101010101010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1020408100000ULL, 0ULL, 0ULL, 0x101010101000000ULL, 0ULL, 0ULL, 0ULL, 0x1020408000000ULL, 0ULL, 0ULL, 0ULL, 0x101010100000000ULL, 0ULL, 0ULL, 0x1020400000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101010000000000ULL, 0ULL, 0x1020000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000000000ULL, 0x1000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000ULL, 0x3000000000000ULL, 0x7000000000000ULL, 0xf000000000000ULL, 0x1f000000000000ULL, 0x3f000000000000ULL, 0x7f000000000000ULL, 0x1010000000000ULL, 0x1000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0x202020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040810204000ULL, 0ULL, 0x202020202020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040810200000ULL, 0ULL, 0ULL, 0x202020202000000ULL, 0ULL, 0ULL, 0ULL, 0x102040810000000ULL, 0ULL, 0ULL, 0ULL, 0x202020200000000ULL, 0ULL, 0ULL, 0x102040800000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020000000000ULL, 0ULL, 0x102040000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x402000000000000ULL, 0x202000000000000ULL, 0x102000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x6000000000000ULL, 0ULL, 0x3000000000000ULL, 0x7000000000000ULL, 0xf000000000000ULL, 0x1f000000000000ULL, 0x3f000000000000ULL, 0x7f000000000000ULL, 0x2040000000000ULL, 0x2020000000000ULL, 0x2010000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0x404040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204081020400000ULL, 0ULL, 0ULL, 0x404040404000000ULL, 0ULL, 0ULL, 0ULL, 0x204081020000000ULL, 0ULL, 0ULL, 0ULL, 0x404040400000000ULL, 0ULL, 0ULL, 0x204081000000000ULL, 0ULL, 0ULL, 0x804020000000000ULL, 0ULL, 0x404040000000000ULL, 0ULL, 0x204080000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x804000000000000ULL, 0x404000000000000ULL, 0x204000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe000000000000ULL, 0xc000000000000ULL, 0ULL, 0x6000000000000ULL, 0xe000000000000ULL, 0x1e000000000000ULL, 0x3e000000000000ULL, 0x7e000000000000ULL, 0ULL, 0x4080000000000ULL, 0x4040000000000ULL, 0x4020000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0x808080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808000000ULL, 0ULL, 0ULL, 0ULL, 0x408102040000000ULL, 0x1008040200000000ULL, 0ULL, 0ULL, 0x808080800000000ULL, 0ULL, 0ULL, 0x408102000000000ULL, 0ULL, 0ULL, 0x1008040000000000ULL, 0ULL, 0x808080000000000ULL, 0ULL, 0x408100000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008000000000000ULL, 0x808000000000000ULL, 0x408000000000000ULL, 0ULL, 0ULL, 0ULL, 0x1e000000000000ULL, 0x1c000000000000ULL, 0x18000000000000ULL, 0ULL, 0xc000000000000ULL, 0x1c000000000000ULL, 0x3c000000000000ULL, 0x7c000000000000ULL, 0ULL, 0ULL, 0x8100000000000ULL, 0x8080000000000ULL, 0x8040000000000ULL, 0ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010100000ULL, 0ULL, 0ULL, 0ULL, 0x2010080402000000ULL, 0ULL, 0ULL, 0ULL, 0x1010101010000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010080400000000ULL, 0ULL, 0ULL, 0x1010101000000000ULL, 0ULL, 0ULL, 0x810204000000000ULL, 0ULL, 0ULL, 0x2010080000000000ULL, 0ULL, 0x1010100000000000ULL, 0ULL, 0x810200000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010000000000000ULL, 0x1010000000000000ULL, 0x810000000000000ULL, 0ULL, 0ULL, 0x3e000000000000ULL, 0x3c000000000000ULL, 0x38000000000000ULL, 0x30000000000000ULL, 0ULL, 0x18000000000000ULL, 0x38000000000000ULL, 0x78000000000000ULL, 0ULL, 0ULL, 0ULL, 0x10200000000000ULL, 0x10100000000000ULL, 0x10080000000000ULL, 0ULL, 0ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020202000ULL, 0ULL, 0ULL, 0x4020100804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020200000ULL, 0ULL, 0ULL, 0ULL, 0x4020100804000000ULL, 0ULL, 0ULL, 0ULL, 0x2020202020000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100800000000ULL, 0ULL, 0ULL, 0x2020202000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100000000000ULL, 0ULL, 0x2020200000000000ULL, 0ULL, 0x1020400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000000000000ULL, 0x2020000000000000ULL, 0x1020000000000000ULL, 0ULL, 0x7e000000000000ULL, 0x7c000000000000ULL, 0x78000000000000ULL, 0x70000000000000ULL, 0x60000000000000ULL, 0ULL, 0x30000000000000ULL, 0x70000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x20400000000000ULL, 0x20200000000000ULL, 0x20100000000000ULL, 0ULL},
-{0x8040201008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040404000ULL, 0ULL, 0ULL, 0x8040201008040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040400000ULL, 0ULL, 0ULL, 0ULL, 0x8040201008000000ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040201000000000ULL, 0ULL, 0ULL, 0x4040404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200000000000ULL, 0ULL, 0x4040400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000000000000ULL, 0x4040000000000000ULL, 0x2040000000000000ULL, 0xfe000000000000ULL, 0xfc000000000000ULL, 0xf8000000000000ULL, 0xf0000000000000ULL, 0xe0000000000000ULL, 0xc0000000000000ULL, 0ULL, 0x60000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x40800000000000ULL, 0x40400000000000ULL, 0x40200000000000ULL},
-{0ULL, 0x80402010080400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080808000ULL, 0ULL, 0ULL, 0x80402010080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800000ULL, 0ULL, 0ULL, 0ULL, 0x80402010000000ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80402000000000ULL, 0ULL, 0ULL, 0x8080808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80400000000000ULL, 0ULL, 0x8080800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000000000000ULL, 0x8080000000000000ULL, 0xfe000000000000ULL, 0xfc000000000000ULL, 0xf8000000000000ULL, 0xf0000000000000ULL, 0xe0000000000000ULL, 0xc0000000000000ULL, 0x80000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x80000000000000ULL, 0x80800000000000ULL},
-{0x101010101010100ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040810204000ULL, 0x101010101010000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040810200000ULL, 0ULL, 0x101010101000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x102040810000000ULL, 0ULL, 0ULL, 0x101010100000000ULL, 0ULL, 0ULL, 0ULL, 0x102040800000000ULL, 0ULL, 0ULL, 0ULL, 0x101010000000000ULL, 0ULL, 0ULL, 0x102040000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x101000000000000ULL, 0ULL, 0x102000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000000000ULL, 0x100000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x100000000000000ULL, 0x300000000000000ULL, 0x700000000000000ULL, 0xf00000000000000ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL, 0x7f00000000000000ULL},
-{0ULL, 0x202020202020200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202020202020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204081020400000ULL, 0ULL, 0x202020202000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x204081020000000ULL, 0ULL, 0ULL, 0x202020200000000ULL, 0ULL, 0ULL, 0ULL, 0x204081000000000ULL, 0ULL, 0ULL, 0ULL, 0x202020000000000ULL, 0ULL, 0ULL, 0x204080000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x202000000000000ULL, 0ULL, 0x204000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x200000000000000ULL, 0x200000000000000ULL, 0x200000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x600000000000000ULL, 0ULL, 0x300000000000000ULL, 0x700000000000000ULL, 0xf00000000000000ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL, 0x7f00000000000000ULL},
-{0ULL, 0ULL, 0x404040404040400ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x404040404000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x408102040000000ULL, 0ULL, 0ULL, 0x404040400000000ULL, 0ULL, 0ULL, 0ULL, 0x408102000000000ULL, 0ULL, 0ULL, 0ULL, 0x404040000000000ULL, 0ULL, 0ULL, 0x408100000000000ULL, 0ULL, 0ULL, 0x402000000000000ULL, 0ULL, 0x404000000000000ULL, 0ULL, 0x408000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x400000000000000ULL, 0x400000000000000ULL, 0x400000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0xe00000000000000ULL, 0xc00000000000000ULL, 0ULL, 0x600000000000000ULL, 0xe00000000000000ULL, 0x1e00000000000000ULL, 0x3e00000000000000ULL, 0x7e00000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0x808080808080800ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808080000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080808000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x808080800000000ULL, 0ULL, 0ULL, 0ULL, 0x810204000000000ULL, 0x804020000000000ULL, 0ULL, 0ULL, 0x808080000000000ULL, 0ULL, 0ULL, 0x810200000000000ULL, 0ULL, 0ULL, 0x804000000000000ULL, 0ULL, 0x808000000000000ULL, 0ULL, 0x810000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x800000000000000ULL, 0x800000000000000ULL, 0x800000000000000ULL, 0ULL, 0ULL, 0ULL, 0x1e00000000000000ULL, 0x1c00000000000000ULL, 0x1800000000000000ULL, 0ULL, 0xc00000000000000ULL, 0x1c00000000000000ULL, 0x3c00000000000000ULL, 0x7c00000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010101000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010100000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1010101010000000ULL, 0ULL, 0ULL, 0ULL, 0x1008040200000000ULL, 0ULL, 0ULL, 0ULL, 0x1010101000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1008040000000000ULL, 0ULL, 0ULL, 0x1010100000000000ULL, 0ULL, 0ULL, 0x1020400000000000ULL, 0ULL, 0ULL, 0x1008000000000000ULL, 0ULL, 0x1010000000000000ULL, 0ULL, 0x1020000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x1000000000000000ULL, 0x1000000000000000ULL, 0x1000000000000000ULL, 0ULL, 0ULL, 0x3e00000000000000ULL, 0x3c00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL, 0ULL, 0x1800000000000000ULL, 0x3800000000000000ULL, 0x7800000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020202000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020200000ULL, 0ULL, 0ULL, 0x2010080402000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2020202020000000ULL, 0ULL, 0ULL, 0ULL, 0x2010080400000000ULL, 0ULL, 0ULL, 0ULL, 0x2020202000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010080000000000ULL, 0ULL, 0ULL, 0x2020200000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2010000000000000ULL, 0ULL, 0x2020000000000000ULL, 0ULL, 0x2040000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x2000000000000000ULL, 0x2000000000000000ULL, 0x2000000000000000ULL, 0ULL, 0x7e00000000000000ULL, 0x7c00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL, 0x6000000000000000ULL, 0ULL, 0x3000000000000000ULL, 0x7000000000000000ULL},
-{0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040404000ULL, 0ULL, 0x4020100804020000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040400000ULL, 0ULL, 0ULL, 0x4020100804000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4040404040000000ULL, 0ULL, 0ULL, 0ULL, 0x4020100800000000ULL, 0ULL, 0ULL, 0ULL, 0x4040404000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020100000000000ULL, 0ULL, 0ULL, 0x4040400000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4020000000000000ULL, 0ULL, 0x4040000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x4000000000000000ULL, 0x4000000000000000ULL, 0x4000000000000000ULL, 0xfe00000000000000ULL, 0xfc00000000000000ULL, 0xf800000000000000ULL, 0xf000000000000000ULL, 0xe000000000000000ULL, 0xc000000000000000ULL, 0ULL, 0x6000000000000000ULL},
-{0x8040201008040200ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080808000ULL, 0ULL, 0x8040201008040000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080800000ULL, 0ULL, 0ULL, 0x8040201008000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8080808080000000ULL, 0ULL, 0ULL, 0ULL, 0x8040201000000000ULL, 0ULL, 0ULL, 0ULL, 0x8080808000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040200000000000ULL, 0ULL, 0ULL, 0x8080800000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8040000000000000ULL, 0ULL, 0x8080000000000000ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0ULL, 0x8000000000000000ULL, 0x8000000000000000ULL, 0xfe00000000000000ULL, 0xfc00000000000000ULL, 0xf800000000000000ULL, 0xf000000000000000ULL, 0xe000000000000000ULL, 0xc000000000000000ULL, 0x8000000000000000ULL, 0ULL}};
-
-// squares from destination to source and the rest of the X set to 1
-uint64_t attacking[64][64] = {{0x0ULL, 0x101010101010103ULL, 0x101010101010107ULL, 0x10101010101010fULL, 0x10101010101011fULL, 0x10101010101013fULL, 0x10101010101017fULL, 0x1010101010101ffULL, 0x1ffULL, 0x201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ffULL, 0x0ULL, 0x40201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ffULL, 0x0ULL, 0x0ULL, 0x8040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1008040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x201008040201ULL, 0x0ULL, 0x0ULL, 0x10101010101ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40201008040201ULL, 0x0ULL, 0x1010101010101ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040201008040201ULL},
-{0x2020202020202ffULL, 0x0ULL, 0x202020202020207ULL, 0x20202020202020fULL, 0x20202020202021fULL, 0x20202020202023fULL, 0x20202020202027fULL, 0x2020202020202ffULL, 0x80402010080502ULL, 0x2ffULL, 0x502ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ffULL, 0x0ULL, 0x80502ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ffULL, 0x0ULL, 0x0ULL, 0x10080502ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2010080502ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x402010080502ULL, 0x0ULL, 0x0ULL, 0x20202020202ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80402010080502ULL, 0x0ULL, 0x2020202020202ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x4040404040404ffULL, 0x4040404040404feULL, 0x0ULL, 0x40404040404040fULL, 0x40404040404041fULL, 0x40404040404043fULL, 0x40404040404047fULL, 0x4040404040404ffULL, 0x0ULL, 0x804020100a04ULL, 0x4ffULL, 0x10a04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a04ULL, 0x0ULL, 0x404ffULL, 0x0ULL, 0x110a04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ffULL, 0x0ULL, 0x0ULL, 0x20110a04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a04ULL, 0x0ULL, 0x0ULL, 0x40404040404ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404040404ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x8080808080808ffULL, 0x8080808080808feULL, 0x8080808080808fcULL, 0x0ULL, 0x80808080808081fULL, 0x80808080808083fULL, 0x80808080808087fULL, 0x8080808080808ffULL, 0x0ULL, 0x0ULL, 0x8040201408ULL, 0x8ffULL, 0x1021408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040221408ULL, 0x0ULL, 0x808ffULL, 0x0ULL, 0x1221408ULL, 0x0ULL, 0x0ULL, 0x8041221408ULL, 0x0ULL, 0x0ULL, 0x80808ffULL, 0x0ULL, 0x0ULL, 0x41221408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8041221408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080808ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808080808ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x10101010101010ffULL, 0x10101010101010feULL, 0x10101010101010fcULL, 0x10101010101010f8ULL, 0x0ULL, 0x101010101010103fULL, 0x101010101010107fULL, 0x10101010101010ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80402810ULL, 0x10ffULL, 0x102042810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80442810ULL, 0x0ULL, 0x1010ffULL, 0x0ULL, 0x102442810ULL, 0x0ULL, 0x0ULL, 0x82442810ULL, 0x0ULL, 0x0ULL, 0x101010ffULL, 0x0ULL, 0x0ULL, 0x182442810ULL, 0x182442810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101010ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101010ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101010ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101010101010ffULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x20202020202020ffULL, 0x20202020202020feULL, 0x20202020202020fcULL, 0x20202020202020f8ULL, 0x20202020202020f0ULL, 0x0ULL, 0x202020202020207fULL, 0x20202020202020ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x805020ULL, 0x20ffULL, 0x10204085020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x885020ULL, 0x0ULL, 0x2020ffULL, 0x0ULL, 0x10204885020ULL, 0x0ULL, 0x0ULL, 0x4885020ULL, 0x0ULL, 0x0ULL, 0x202020ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204885020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020ffULL, 0x0ULL, 0x0ULL, 0x10204885020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202020ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202020ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020202020ffULL, 0x0ULL, 0x0ULL},
-{0x40404040404040ffULL, 0x40404040404040feULL, 0x40404040404040fcULL, 0x40404040404040f8ULL, 0x40404040404040f0ULL, 0x40404040404040e0ULL, 0x0ULL, 0x40404040404040ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040ULL, 0x40ffULL, 0x102040810a040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040ULL, 0x0ULL, 0x4040ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040ULL, 0x0ULL, 0x0ULL, 0x404040ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040ffULL, 0x0ULL, 0x0ULL, 0x2040810a040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404040ffULL, 0x0ULL, 0x102040810a040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404040ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040404040ffULL, 0x0ULL},
-{0x80808080808080ffULL, 0x80808080808080feULL, 0x80808080808080fcULL, 0x80808080808080f8ULL, 0x80808080808080f0ULL, 0x80808080808080e0ULL, 0x80808080808080c0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080ULL, 0x80ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204080ULL, 0x0ULL, 0x8080ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10204080ULL, 0x0ULL, 0x0ULL, 0x808080ffULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080ffULL, 0x0ULL, 0x0ULL, 0x40810204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808080ffULL, 0x0ULL, 0x2040810204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808080ffULL, 0x102040810204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080808080ffULL},
-{0x10101010101ff01ULL, 0x4020100804020102ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101010301ULL, 0x101010101010701ULL, 0x101010101010f01ULL, 0x101010101011f01ULL, 0x101010101013f01ULL, 0x101010101017f01ULL, 0x10101010101ff01ULL, 0x1ff01ULL, 0x20102ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff01ULL, 0x0ULL, 0x4020102ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff01ULL, 0x0ULL, 0x0ULL, 0x804020102ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ff01ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x100804020102ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101ff01ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20100804020102ULL, 0x0ULL, 0x0ULL, 0x10101010101ff01ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020100804020102ULL, 0x0ULL},
-{0x8040201008050205ULL, 0x20202020202ff02ULL, 0x8040201008050205ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020202ff02ULL, 0x0ULL, 0x202020202020702ULL, 0x202020202020f02ULL, 0x202020202021f02ULL, 0x202020202023f02ULL, 0x202020202027f02ULL, 0x20202020202ff02ULL, 0x8040201008050205ULL, 0x2ff02ULL, 0x50205ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff02ULL, 0x0ULL, 0x8050205ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff02ULL, 0x0ULL, 0x0ULL, 0x1008050205ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ff02ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x201008050205ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202ff02ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40201008050205ULL, 0x0ULL, 0x0ULL, 0x20202020202ff02ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040201008050205ULL},
-{0x0ULL, 0x804020110a040aULL, 0x40404040404ff04ULL, 0x804020110a040aULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040404ff04ULL, 0x40404040404fe04ULL, 0x0ULL, 0x404040404040f04ULL, 0x404040404041f04ULL, 0x404040404043f04ULL, 0x404040404047f04ULL, 0x40404040404ff04ULL, 0x0ULL, 0x804020100a040aULL, 0x4ff04ULL, 0x10a040aULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a040aULL, 0x0ULL, 0x404ff04ULL, 0x0ULL, 0x110a040aULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff04ULL, 0x0ULL, 0x0ULL, 0x20110a040aULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404ff04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a040aULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404ff04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a040aULL, 0x0ULL, 0x0ULL, 0x40404040404ff04ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x804122140814ULL, 0x80808080808ff08ULL, 0x804122140814ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080808ff08ULL, 0x80808080808fe08ULL, 0x80808080808fc08ULL, 0x0ULL, 0x808080808081f08ULL, 0x808080808083f08ULL, 0x808080808087f08ULL, 0x80808080808ff08ULL, 0x0ULL, 0x0ULL, 0x804020140814ULL, 0x8ff08ULL, 0x102140814ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804022140814ULL, 0x0ULL, 0x808ff08ULL, 0x0ULL, 0x122140814ULL, 0x0ULL, 0x0ULL, 0x804122140814ULL, 0x0ULL, 0x0ULL, 0x80808ff08ULL, 0x0ULL, 0x0ULL, 0x4122140814ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808ff08ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804122140814ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808ff08ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080808ff08ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x18244281028ULL, 0x101010101010ff10ULL, 0x18244281028ULL, 0x0ULL, 0x0ULL, 0x101010101010ff10ULL, 0x101010101010fe10ULL, 0x101010101010fc10ULL, 0x101010101010f810ULL, 0x0ULL, 0x1010101010103f10ULL, 0x1010101010107f10ULL, 0x101010101010ff10ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040281028ULL, 0x10ff10ULL, 0x10204281028ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8044281028ULL, 0x0ULL, 0x1010ff10ULL, 0x0ULL, 0x10244281028ULL, 0x0ULL, 0x0ULL, 0x8244281028ULL, 0x0ULL, 0x0ULL, 0x101010ff10ULL, 0x0ULL, 0x0ULL, 0x18244281028ULL, 0x18244281028ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101010ff10ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101010ff10ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101010ff10ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020488502050ULL, 0x202020202020ff20ULL, 0x1020488502050ULL, 0x0ULL, 0x202020202020ff20ULL, 0x202020202020fe20ULL, 0x202020202020fc20ULL, 0x202020202020f820ULL, 0x202020202020f020ULL, 0x0ULL, 0x2020202020207f20ULL, 0x202020202020ff20ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80502050ULL, 0x20ff20ULL, 0x1020408502050ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x88502050ULL, 0x0ULL, 0x2020ff20ULL, 0x0ULL, 0x1020488502050ULL, 0x0ULL, 0x0ULL, 0x488502050ULL, 0x0ULL, 0x0ULL, 0x202020ff20ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20488502050ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020ff20ULL, 0x0ULL, 0x0ULL, 0x1020488502050ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202020ff20ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202020ff20ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040810a040a0ULL, 0x404040404040ff40ULL, 0x102040810a040a0ULL, 0x404040404040ff40ULL, 0x404040404040fe40ULL, 0x404040404040fc40ULL, 0x404040404040f840ULL, 0x404040404040f040ULL, 0x404040404040e040ULL, 0x0ULL, 0x404040404040ff40ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a0ULL, 0x40ff40ULL, 0x102040810a040a0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a0ULL, 0x0ULL, 0x4040ff40ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a0ULL, 0x0ULL, 0x0ULL, 0x404040ff40ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040ff40ULL, 0x0ULL, 0x0ULL, 0x2040810a040a0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404040ff40ULL, 0x0ULL, 0x102040810a040a0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404040ff40ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204081020408040ULL, 0x808080808080ff80ULL, 0x808080808080ff80ULL, 0x808080808080fe80ULL, 0x808080808080fc80ULL, 0x808080808080f880ULL, 0x808080808080f080ULL, 0x808080808080e080ULL, 0x808080808080c080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x408040ULL, 0x80ff80ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20408040ULL, 0x0ULL, 0x8080ff80ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040ULL, 0x0ULL, 0x0ULL, 0x808080ff80ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x81020408040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080ff80ULL, 0x0ULL, 0x0ULL, 0x4081020408040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808080ff80ULL, 0x0ULL, 0x204081020408040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808080ff80ULL},
-{0x101010101ff0101ULL, 0x0ULL, 0x2010080402010204ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101ff0100ULL, 0x2010080402010200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101030101ULL, 0x101010101070101ULL, 0x1010101010f0101ULL, 0x1010101011f0101ULL, 0x1010101013f0101ULL, 0x1010101017f0101ULL, 0x101010101ff0101ULL, 0x1ff0101ULL, 0x2010204ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff0101ULL, 0x0ULL, 0x402010204ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff0101ULL, 0x0ULL, 0x0ULL, 0x80402010204ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ff0101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10080402010204ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010101ff0101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2010080402010204ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x202020202ff0202ULL, 0x0ULL, 0x4020100805020508ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020100805020508ULL, 0x202020202ff0200ULL, 0x4020100805020500ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202ff0202ULL, 0x0ULL, 0x202020202070202ULL, 0x2020202020f0202ULL, 0x2020202021f0202ULL, 0x2020202023f0202ULL, 0x2020202027f0202ULL, 0x202020202ff0202ULL, 0x4020100805020508ULL, 0x2ff0202ULL, 0x5020508ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff0202ULL, 0x0ULL, 0x805020508ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff0202ULL, 0x0ULL, 0x0ULL, 0x100805020508ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ff0202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20100805020508ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020202ff0202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020100805020508ULL, 0x0ULL},
-{0x804020110a040a11ULL, 0x0ULL, 0x404040404ff0404ULL, 0x0ULL, 0x804020110a040a11ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a040a10ULL, 0x404040404ff0400ULL, 0x804020110a040a01ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404ff0404ULL, 0x404040404fe0404ULL, 0x0ULL, 0x4040404040f0404ULL, 0x4040404041f0404ULL, 0x4040404043f0404ULL, 0x4040404047f0404ULL, 0x404040404ff0404ULL, 0x0ULL, 0x804020100a040a11ULL, 0x4ff0404ULL, 0x10a040a11ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a040a11ULL, 0x0ULL, 0x404ff0404ULL, 0x0ULL, 0x110a040a11ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff0404ULL, 0x0ULL, 0x0ULL, 0x20110a040a11ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404ff0404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a040a11ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040404ff0404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020110a040a11ULL},
-{0x0ULL, 0x80412214081422ULL, 0x0ULL, 0x808080808ff0808ULL, 0x0ULL, 0x80412214081422ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80412214081420ULL, 0x808080808ff0800ULL, 0x80412214081402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808ff0808ULL, 0x808080808fe0808ULL, 0x808080808fc0808ULL, 0x0ULL, 0x8080808081f0808ULL, 0x8080808083f0808ULL, 0x8080808087f0808ULL, 0x808080808ff0808ULL, 0x0ULL, 0x0ULL, 0x80402014081422ULL, 0x8ff0808ULL, 0x10214081422ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80402214081422ULL, 0x0ULL, 0x808ff0808ULL, 0x0ULL, 0x12214081422ULL, 0x0ULL, 0x0ULL, 0x80412214081422ULL, 0x0ULL, 0x0ULL, 0x80808ff0808ULL, 0x0ULL, 0x0ULL, 0x412214081422ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808ff0808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80412214081422ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080808ff0808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x1824428102844ULL, 0x0ULL, 0x1010101010ff1010ULL, 0x0ULL, 0x1824428102844ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1824428102840ULL, 0x1010101010ff1000ULL, 0x1824428102804ULL, 0x0ULL, 0x0ULL, 0x1010101010ff1010ULL, 0x1010101010fe1010ULL, 0x1010101010fc1010ULL, 0x1010101010f81010ULL, 0x0ULL, 0x10101010103f1010ULL, 0x10101010107f1010ULL, 0x1010101010ff1010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804028102844ULL, 0x10ff1010ULL, 0x1020428102844ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804428102844ULL, 0x0ULL, 0x1010ff1010ULL, 0x0ULL, 0x1024428102844ULL, 0x0ULL, 0x0ULL, 0x824428102844ULL, 0x0ULL, 0x0ULL, 0x101010ff1010ULL, 0x0ULL, 0x0ULL, 0x1824428102844ULL, 0x1824428102844ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101010ff1010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101010ff1010ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x102048850205088ULL, 0x0ULL, 0x2020202020ff2020ULL, 0x0ULL, 0x102048850205088ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102048850205080ULL, 0x2020202020ff2000ULL, 0x102048850205008ULL, 0x0ULL, 0x2020202020ff2020ULL, 0x2020202020fe2020ULL, 0x2020202020fc2020ULL, 0x2020202020f82020ULL, 0x2020202020f02020ULL, 0x0ULL, 0x20202020207f2020ULL, 0x2020202020ff2020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8050205088ULL, 0x20ff2020ULL, 0x102040850205088ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205088ULL, 0x0ULL, 0x2020ff2020ULL, 0x0ULL, 0x102048850205088ULL, 0x0ULL, 0x0ULL, 0x48850205088ULL, 0x0ULL, 0x0ULL, 0x202020ff2020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2048850205088ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020ff2020ULL, 0x0ULL, 0x0ULL, 0x102048850205088ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202020ff2020ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040810a040a010ULL, 0x0ULL, 0x4040404040ff4040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040810a040a000ULL, 0x4040404040ff4000ULL, 0x2040810a040a010ULL, 0x4040404040ff4040ULL, 0x4040404040fe4040ULL, 0x4040404040fc4040ULL, 0x4040404040f84040ULL, 0x4040404040f04040ULL, 0x4040404040e04040ULL, 0x0ULL, 0x4040404040ff4040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a010ULL, 0x40ff4040ULL, 0x2040810a040a010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a010ULL, 0x0ULL, 0x4040ff4040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a010ULL, 0x0ULL, 0x0ULL, 0x404040ff4040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040ff4040ULL, 0x0ULL, 0x0ULL, 0x2040810a040a010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404040ff4040ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x408102040804020ULL, 0x0ULL, 0x8080808080ff8080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x408102040804000ULL, 0x8080808080ff8000ULL, 0x8080808080ff8080ULL, 0x8080808080fe8080ULL, 0x8080808080fc8080ULL, 0x8080808080f88080ULL, 0x8080808080f08080ULL, 0x8080808080e08080ULL, 0x8080808080c08080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40804020ULL, 0x80ff8080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804020ULL, 0x0ULL, 0x8080ff8080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040804020ULL, 0x0ULL, 0x0ULL, 0x808080ff8080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8102040804020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080ff8080ULL, 0x0ULL, 0x0ULL, 0x408102040804020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808080ff8080ULL},
-{0x1010101ff010101ULL, 0x0ULL, 0x0ULL, 0x1008040201020408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ff010100ULL, 0x0ULL, 0x1008040201020400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ff010000ULL, 0x1008040201020000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010103010101ULL, 0x101010107010101ULL, 0x10101010f010101ULL, 0x10101011f010101ULL, 0x10101013f010101ULL, 0x10101017f010101ULL, 0x1010101ff010101ULL, 0x1ff010101ULL, 0x201020408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff010101ULL, 0x0ULL, 0x40201020408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff010101ULL, 0x0ULL, 0x0ULL, 0x8040201020408ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010101ff010101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1008040201020408ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x2020202ff020202ULL, 0x0ULL, 0x0ULL, 0x2010080502050810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ff020200ULL, 0x0ULL, 0x2010080502050800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2010080502050810ULL, 0x2020202ff020000ULL, 0x2010080502050000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ff020202ULL, 0x0ULL, 0x202020207020202ULL, 0x20202020f020202ULL, 0x20202021f020202ULL, 0x20202023f020202ULL, 0x20202027f020202ULL, 0x2020202ff020202ULL, 0x2010080502050810ULL, 0x2ff020202ULL, 0x502050810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff020202ULL, 0x0ULL, 0x80502050810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff020202ULL, 0x0ULL, 0x0ULL, 0x10080502050810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020202ff020202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2010080502050810ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x4040404ff040404ULL, 0x0ULL, 0x0ULL, 0x4020110a040a1120ULL, 0x0ULL, 0x0ULL, 0x4020110a040a1120ULL, 0x0ULL, 0x4040404ff040400ULL, 0x0ULL, 0x4020110a040a1100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a040a1020ULL, 0x4040404ff040000ULL, 0x4020110a040a0100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404ff040404ULL, 0x4040404fe040404ULL, 0x0ULL, 0x40404040f040404ULL, 0x40404041f040404ULL, 0x40404043f040404ULL, 0x40404047f040404ULL, 0x4040404ff040404ULL, 0x0ULL, 0x4020100a040a1120ULL, 0x4ff040404ULL, 0x10a040a1120ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a040a1120ULL, 0x0ULL, 0x404ff040404ULL, 0x0ULL, 0x110a040a1120ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff040404ULL, 0x0ULL, 0x0ULL, 0x20110a040a1120ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040404ff040404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4020110a040a1120ULL, 0x0ULL},
-{0x8041221408142241ULL, 0x0ULL, 0x0ULL, 0x8080808ff080808ULL, 0x0ULL, 0x0ULL, 0x8041221408142241ULL, 0x0ULL, 0x0ULL, 0x8041221408142240ULL, 0x0ULL, 0x8080808ff080800ULL, 0x0ULL, 0x8041221408142201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8041221408142040ULL, 0x8080808ff080000ULL, 0x8041221408140201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808ff080808ULL, 0x8080808fe080808ULL, 0x8080808fc080808ULL, 0x0ULL, 0x80808081f080808ULL, 0x80808083f080808ULL, 0x80808087f080808ULL, 0x8080808ff080808ULL, 0x0ULL, 0x0ULL, 0x8040201408142241ULL, 0x8ff080808ULL, 0x1021408142241ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040221408142241ULL, 0x0ULL, 0x808ff080808ULL, 0x0ULL, 0x1221408142241ULL, 0x0ULL, 0x0ULL, 0x8041221408142241ULL, 0x0ULL, 0x0ULL, 0x80808ff080808ULL, 0x0ULL, 0x0ULL, 0x41221408142241ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080808ff080808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8041221408142241ULL},
-{0x0ULL, 0x182442810284482ULL, 0x0ULL, 0x0ULL, 0x10101010ff101010ULL, 0x0ULL, 0x0ULL, 0x182442810284482ULL, 0x0ULL, 0x0ULL, 0x182442810284480ULL, 0x0ULL, 0x10101010ff101000ULL, 0x0ULL, 0x182442810284402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x182442810284080ULL, 0x10101010ff100000ULL, 0x182442810280402ULL, 0x0ULL, 0x0ULL, 0x10101010ff101010ULL, 0x10101010fe101010ULL, 0x10101010fc101010ULL, 0x10101010f8101010ULL, 0x0ULL, 0x101010103f101010ULL, 0x101010107f101010ULL, 0x10101010ff101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80402810284482ULL, 0x10ff101010ULL, 0x102042810284482ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80442810284482ULL, 0x0ULL, 0x1010ff101010ULL, 0x0ULL, 0x102442810284482ULL, 0x0ULL, 0x0ULL, 0x82442810284482ULL, 0x0ULL, 0x0ULL, 0x101010ff101010ULL, 0x0ULL, 0x0ULL, 0x182442810284482ULL, 0x182442810284482ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101010ff101010ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x204885020508804ULL, 0x0ULL, 0x0ULL, 0x20202020ff202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204885020508800ULL, 0x0ULL, 0x20202020ff202000ULL, 0x0ULL, 0x204885020508804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204885020508000ULL, 0x20202020ff200000ULL, 0x204885020500804ULL, 0x0ULL, 0x20202020ff202020ULL, 0x20202020fe202020ULL, 0x20202020fc202020ULL, 0x20202020f8202020ULL, 0x20202020f0202020ULL, 0x0ULL, 0x202020207f202020ULL, 0x20202020ff202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x805020508804ULL, 0x20ff202020ULL, 0x204085020508804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x885020508804ULL, 0x0ULL, 0x2020ff202020ULL, 0x0ULL, 0x204885020508804ULL, 0x0ULL, 0x0ULL, 0x4885020508804ULL, 0x0ULL, 0x0ULL, 0x202020ff202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204885020508804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202020ff202020ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a01008ULL, 0x0ULL, 0x0ULL, 0x40404040ff404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a01000ULL, 0x0ULL, 0x40404040ff404000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a00000ULL, 0x40404040ff400000ULL, 0x40810a040a01008ULL, 0x40404040ff404040ULL, 0x40404040fe404040ULL, 0x40404040fc404040ULL, 0x40404040f8404040ULL, 0x40404040f0404040ULL, 0x40404040e0404040ULL, 0x0ULL, 0x40404040ff404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a01008ULL, 0x40ff404040ULL, 0x40810a040a01008ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a01008ULL, 0x0ULL, 0x4040ff404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a01008ULL, 0x0ULL, 0x0ULL, 0x404040ff404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40810a040a01008ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404040ff404040ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810204080402010ULL, 0x0ULL, 0x0ULL, 0x80808080ff808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810204080402000ULL, 0x0ULL, 0x80808080ff808000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810204080400000ULL, 0x80808080ff800000ULL, 0x80808080ff808080ULL, 0x80808080fe808080ULL, 0x80808080fc808080ULL, 0x80808080f8808080ULL, 0x80808080f0808080ULL, 0x80808080e0808080ULL, 0x80808080c0808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080402010ULL, 0x80ff808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x204080402010ULL, 0x0ULL, 0x8080ff808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10204080402010ULL, 0x0ULL, 0x0ULL, 0x808080ff808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810204080402010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808080ff808080ULL},
-{0x10101ff01010101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x804020102040810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff01010100ULL, 0x0ULL, 0x0ULL, 0x804020102040800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff01010000ULL, 0x0ULL, 0x804020102040000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff01000000ULL, 0x804020102000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010301010101ULL, 0x101010701010101ULL, 0x101010f01010101ULL, 0x101011f01010101ULL, 0x101013f01010101ULL, 0x101017f01010101ULL, 0x10101ff01010101ULL, 0x1ff01010101ULL, 0x20102040810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff01010101ULL, 0x0ULL, 0x4020102040810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10101ff01010101ULL, 0x0ULL, 0x0ULL, 0x804020102040810ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x20202ff02020202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1008050205081020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff02020200ULL, 0x0ULL, 0x0ULL, 0x1008050205081000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff02020000ULL, 0x0ULL, 0x1008050205080000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1008050205081020ULL, 0x20202ff02000000ULL, 0x1008050205000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff02020202ULL, 0x0ULL, 0x202020702020202ULL, 0x202020f02020202ULL, 0x202021f02020202ULL, 0x202023f02020202ULL, 0x202027f02020202ULL, 0x20202ff02020202ULL, 0x1008050205081020ULL, 0x2ff02020202ULL, 0x50205081020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff02020202ULL, 0x0ULL, 0x8050205081020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20202ff02020202ULL, 0x0ULL, 0x0ULL, 0x1008050205081020ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x40404ff04040404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20110a040a112040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff04040400ULL, 0x0ULL, 0x0ULL, 0x20110a040a112000ULL, 0x0ULL, 0x0ULL, 0x20110a040a112040ULL, 0x0ULL, 0x40404ff04040000ULL, 0x0ULL, 0x20110a040a110000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20110a040a102040ULL, 0x40404ff04000000ULL, 0x20110a040a010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff04040404ULL, 0x40404fe04040404ULL, 0x0ULL, 0x404040f04040404ULL, 0x404041f04040404ULL, 0x404043f04040404ULL, 0x404047f04040404ULL, 0x40404ff04040404ULL, 0x0ULL, 0x20100a040a112040ULL, 0x4ff04040404ULL, 0x10a040a112040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20110a040a112040ULL, 0x0ULL, 0x404ff04040404ULL, 0x0ULL, 0x110a040a112040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40404ff04040404ULL, 0x0ULL, 0x0ULL, 0x20110a040a112040ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x80808ff08080808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4122140814224180ULL, 0x4122140814224180ULL, 0x0ULL, 0x0ULL, 0x80808ff08080800ULL, 0x0ULL, 0x0ULL, 0x4122140814224100ULL, 0x0ULL, 0x0ULL, 0x4122140814224080ULL, 0x0ULL, 0x80808ff08080000ULL, 0x0ULL, 0x4122140814220100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4122140814204080ULL, 0x80808ff08000000ULL, 0x4122140814020100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80808ff08080808ULL, 0x80808fe08080808ULL, 0x80808fc08080808ULL, 0x0ULL, 0x808081f08080808ULL, 0x808083f08080808ULL, 0x808087f08080808ULL, 0x80808ff08080808ULL, 0x0ULL, 0x0ULL, 0x4020140814224180ULL, 0x8ff08080808ULL, 0x102140814224180ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4022140814224180ULL, 0x0ULL, 0x808ff08080808ULL, 0x0ULL, 0x122140814224180ULL, 0x0ULL, 0x0ULL, 0x4122140814224180ULL, 0x0ULL, 0x0ULL, 0x80808ff08080808ULL, 0x0ULL, 0x0ULL, 0x4122140814224180ULL, 0x0ULL},
-{0x8244281028448201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101010ff10101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8244281028448200ULL, 0x0ULL, 0x0ULL, 0x101010ff10101000ULL, 0x0ULL, 0x0ULL, 0x8244281028448201ULL, 0x0ULL, 0x0ULL, 0x8244281028448000ULL, 0x0ULL, 0x101010ff10100000ULL, 0x0ULL, 0x8244281028440201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8244281028408000ULL, 0x101010ff10000000ULL, 0x8244281028040201ULL, 0x0ULL, 0x0ULL, 0x101010ff10101010ULL, 0x101010fe10101010ULL, 0x101010fc10101010ULL, 0x101010f810101010ULL, 0x0ULL, 0x1010103f10101010ULL, 0x1010107f10101010ULL, 0x101010ff10101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040281028448201ULL, 0x10ff10101010ULL, 0x204281028448201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8044281028448201ULL, 0x0ULL, 0x1010ff10101010ULL, 0x0ULL, 0x244281028448201ULL, 0x0ULL, 0x0ULL, 0x8244281028448201ULL, 0x0ULL, 0x0ULL, 0x101010ff10101010ULL, 0x0ULL, 0x0ULL, 0x8244281028448201ULL},
-{0x0ULL, 0x488502050880402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202020ff20202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x488502050880400ULL, 0x0ULL, 0x0ULL, 0x202020ff20202000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x488502050880000ULL, 0x0ULL, 0x202020ff20200000ULL, 0x0ULL, 0x488502050880402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x488502050800000ULL, 0x202020ff20000000ULL, 0x488502050080402ULL, 0x0ULL, 0x202020ff20202020ULL, 0x202020fe20202020ULL, 0x202020fc20202020ULL, 0x202020f820202020ULL, 0x202020f020202020ULL, 0x0ULL, 0x2020207f20202020ULL, 0x202020ff20202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80502050880402ULL, 0x20ff20202020ULL, 0x408502050880402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x88502050880402ULL, 0x0ULL, 0x2020ff20202020ULL, 0x0ULL, 0x488502050880402ULL, 0x0ULL, 0x0ULL, 0x488502050880402ULL, 0x0ULL, 0x0ULL, 0x202020ff20202020ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x810a040a0100804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404040ff40404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a0100800ULL, 0x0ULL, 0x0ULL, 0x404040ff40404000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a0100000ULL, 0x0ULL, 0x404040ff40400000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a0000000ULL, 0x404040ff40000000ULL, 0x810a040a0100804ULL, 0x404040ff40404040ULL, 0x404040fe40404040ULL, 0x404040fc40404040ULL, 0x404040f840404040ULL, 0x404040f040404040ULL, 0x404040e040404040ULL, 0x0ULL, 0x404040ff40404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a0100804ULL, 0x40ff40404040ULL, 0x810a040a0100804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a0100804ULL, 0x0ULL, 0x4040ff40404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x810a040a0100804ULL, 0x0ULL, 0x0ULL, 0x404040ff40404040ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040201008ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808080ff80808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040201000ULL, 0x0ULL, 0x0ULL, 0x808080ff80808000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040200000ULL, 0x0ULL, 0x808080ff80800000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040000000ULL, 0x808080ff80000000ULL, 0x808080ff80808080ULL, 0x808080fe80808080ULL, 0x808080fc80808080ULL, 0x808080f880808080ULL, 0x808080f080808080ULL, 0x808080e080808080ULL, 0x808080c080808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x408040201008ULL, 0x80ff80808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20408040201008ULL, 0x0ULL, 0x8080ff80808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1020408040201008ULL, 0x0ULL, 0x0ULL, 0x808080ff80808080ULL},
-{0x101ff0101010101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x402010204081020ULL, 0x0ULL, 0x0ULL, 0x101ff0101010100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x402010204081000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff0101010000ULL, 0x0ULL, 0x0ULL, 0x402010204080000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff0101000000ULL, 0x0ULL, 0x402010204000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff0100000000ULL, 0x402010200000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101030101010101ULL, 0x101070101010101ULL, 0x1010f0101010101ULL, 0x1011f0101010101ULL, 0x1013f0101010101ULL, 0x1017f0101010101ULL, 0x101ff0101010101ULL, 0x1ff0101010101ULL, 0x2010204081020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x101ff0101010101ULL, 0x0ULL, 0x402010204081020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x202ff0202020202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x805020508102040ULL, 0x0ULL, 0x0ULL, 0x202ff0202020200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x805020508102000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff0202020000ULL, 0x0ULL, 0x0ULL, 0x805020508100000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff0202000000ULL, 0x0ULL, 0x805020508000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x805020508102040ULL, 0x202ff0200000000ULL, 0x805020500000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff0202020202ULL, 0x0ULL, 0x202070202020202ULL, 0x2020f0202020202ULL, 0x2021f0202020202ULL, 0x2023f0202020202ULL, 0x2027f0202020202ULL, 0x202ff0202020202ULL, 0x805020508102040ULL, 0x2ff0202020202ULL, 0x5020508102040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x202ff0202020202ULL, 0x0ULL, 0x805020508102040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x404ff0404040404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x110a040a11204080ULL, 0x0ULL, 0x0ULL, 0x404ff0404040400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x110a040a11204000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404ff0404040000ULL, 0x0ULL, 0x0ULL, 0x110a040a11200000ULL, 0x0ULL, 0x0ULL, 0x110a040a11204080ULL, 0x0ULL, 0x404ff0404000000ULL, 0x0ULL, 0x110a040a11000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x110a040a10204080ULL, 0x404ff0400000000ULL, 0x110a040a01000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x404ff0404040404ULL, 0x404fe0404040404ULL, 0x0ULL, 0x4040f0404040404ULL, 0x4041f0404040404ULL, 0x4043f0404040404ULL, 0x4047f0404040404ULL, 0x404ff0404040404ULL, 0x0ULL, 0x100a040a11204080ULL, 0x4ff0404040404ULL, 0x10a040a11204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x110a040a11204080ULL, 0x0ULL, 0x404ff0404040404ULL, 0x0ULL, 0x110a040a11204080ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x808ff0808080808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808ff0808080800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2214081422418000ULL, 0x2214081422418000ULL, 0x0ULL, 0x0ULL, 0x808ff0808080000ULL, 0x0ULL, 0x0ULL, 0x2214081422410000ULL, 0x0ULL, 0x0ULL, 0x2214081422408000ULL, 0x0ULL, 0x808ff0808000000ULL, 0x0ULL, 0x2214081422010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2214081420408000ULL, 0x808ff0800000000ULL, 0x2214081402010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x808ff0808080808ULL, 0x808fe0808080808ULL, 0x808fc0808080808ULL, 0x0ULL, 0x8081f0808080808ULL, 0x8083f0808080808ULL, 0x8087f0808080808ULL, 0x808ff0808080808ULL, 0x0ULL, 0x0ULL, 0x2014081422418000ULL, 0x8ff0808080808ULL, 0x214081422418000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2214081422418000ULL, 0x0ULL, 0x808ff0808080808ULL, 0x0ULL, 0x2214081422418000ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010ff1010101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4428102844820100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1010ff1010101000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4428102844820000ULL, 0x0ULL, 0x0ULL, 0x1010ff1010100000ULL, 0x0ULL, 0x0ULL, 0x4428102844820100ULL, 0x0ULL, 0x0ULL, 0x4428102844800000ULL, 0x0ULL, 0x1010ff1010000000ULL, 0x0ULL, 0x4428102844020100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4428102840800000ULL, 0x1010ff1000000000ULL, 0x4428102804020100ULL, 0x0ULL, 0x0ULL, 0x1010ff1010101010ULL, 0x1010fe1010101010ULL, 0x1010fc1010101010ULL, 0x1010f81010101010ULL, 0x0ULL, 0x10103f1010101010ULL, 0x10107f1010101010ULL, 0x1010ff1010101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4028102844820100ULL, 0x10ff1010101010ULL, 0x428102844820100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4428102844820100ULL, 0x0ULL, 0x1010ff1010101010ULL, 0x0ULL, 0x4428102844820100ULL, 0x0ULL},
-{0x8850205088040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020ff2020202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205088040200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2020ff2020202000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205088040000ULL, 0x0ULL, 0x0ULL, 0x2020ff2020200000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205088000000ULL, 0x0ULL, 0x2020ff2020000000ULL, 0x0ULL, 0x8850205088040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205080000000ULL, 0x2020ff2000000000ULL, 0x8850205008040201ULL, 0x0ULL, 0x2020ff2020202020ULL, 0x2020fe2020202020ULL, 0x2020fc2020202020ULL, 0x2020f82020202020ULL, 0x2020f02020202020ULL, 0x0ULL, 0x20207f2020202020ULL, 0x2020ff2020202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8050205088040201ULL, 0x20ff2020202020ULL, 0x850205088040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8850205088040201ULL, 0x0ULL, 0x2020ff2020202020ULL, 0x0ULL, 0x8850205088040201ULL},
-{0x0ULL, 0x10a040a010080402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040ff4040404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a010080400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4040ff4040404000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a010080000ULL, 0x0ULL, 0x0ULL, 0x4040ff4040400000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a010000000ULL, 0x0ULL, 0x4040ff4040000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a000000000ULL, 0x4040ff4000000000ULL, 0x10a040a010080402ULL, 0x4040ff4040404040ULL, 0x4040fe4040404040ULL, 0x4040fc4040404040ULL, 0x4040f84040404040ULL, 0x4040f04040404040ULL, 0x4040e04040404040ULL, 0x0ULL, 0x4040ff4040404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a010080402ULL, 0x40ff4040404040ULL, 0x10a040a010080402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10a040a010080402ULL, 0x0ULL, 0x4040ff4040404040ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x2040804020100804ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080ff8080808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804020100800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8080ff8080808000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804020100000ULL, 0x0ULL, 0x0ULL, 0x8080ff8080800000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804020000000ULL, 0x0ULL, 0x8080ff8080000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804000000000ULL, 0x8080ff8000000000ULL, 0x8080ff8080808080ULL, 0x8080fe8080808080ULL, 0x8080fc8080808080ULL, 0x8080f88080808080ULL, 0x8080f08080808080ULL, 0x8080e08080808080ULL, 0x8080c08080808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40804020100804ULL, 0x80ff8080808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2040804020100804ULL, 0x0ULL, 0x8080ff8080808080ULL},
-{0x1ff010101010101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x201020408102040ULL, 0x0ULL, 0x1ff010101010100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x201020408102000ULL, 0x0ULL, 0x0ULL, 0x1ff010101010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x201020408100000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ff010101000000ULL, 0x0ULL, 0x0ULL, 0x201020408000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ff010100000000ULL, 0x0ULL, 0x201020400000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1ff010000000000ULL, 0x201020000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x103010101010101ULL, 0x107010101010101ULL, 0x10f010101010101ULL, 0x11f010101010101ULL, 0x13f010101010101ULL, 0x17f010101010101ULL, 0x1ff010101010101ULL, 0x1ff010101010101ULL, 0x201020408102040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x2ff020202020202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x502050810204080ULL, 0x0ULL, 0x2ff020202020200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x502050810204000ULL, 0x0ULL, 0x0ULL, 0x2ff020202020000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x502050810200000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2ff020202000000ULL, 0x0ULL, 0x0ULL, 0x502050810000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2ff020200000000ULL, 0x0ULL, 0x502050800000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x502050810204080ULL, 0x2ff020000000000ULL, 0x502050000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2ff020202020202ULL, 0x0ULL, 0x207020202020202ULL, 0x20f020202020202ULL, 0x21f020202020202ULL, 0x23f020202020202ULL, 0x27f020202020202ULL, 0x2ff020202020202ULL, 0x502050810204080ULL, 0x2ff020202020202ULL, 0x502050810204080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x4ff040404040404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4ff040404040400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a1120408000ULL, 0x0ULL, 0x0ULL, 0x4ff040404040000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a1120400000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4ff040404000000ULL, 0x0ULL, 0x0ULL, 0xa040a1120000000ULL, 0x0ULL, 0x0ULL, 0xa040a1120408000ULL, 0x0ULL, 0x4ff040400000000ULL, 0x0ULL, 0xa040a1100000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a1020408000ULL, 0x4ff040000000000ULL, 0xa040a0100000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4ff040404040404ULL, 0x4fe040404040404ULL, 0x0ULL, 0x40f040404040404ULL, 0x41f040404040404ULL, 0x43f040404040404ULL, 0x47f040404040404ULL, 0x4ff040404040404ULL, 0x0ULL, 0xa040a1120408000ULL, 0x4ff040404040404ULL, 0xa040a1120408000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x8ff080808080808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8ff080808080800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8ff080808080000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1408142241800000ULL, 0x1408142241800000ULL, 0x0ULL, 0x0ULL, 0x8ff080808000000ULL, 0x0ULL, 0x0ULL, 0x1408142241000000ULL, 0x0ULL, 0x0ULL, 0x1408142240800000ULL, 0x0ULL, 0x8ff080800000000ULL, 0x0ULL, 0x1408142201000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1408142040800000ULL, 0x8ff080000000000ULL, 0x1408140201000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8ff080808080808ULL, 0x8fe080808080808ULL, 0x8fc080808080808ULL, 0x0ULL, 0x81f080808080808ULL, 0x83f080808080808ULL, 0x87f080808080808ULL, 0x8ff080808080808ULL, 0x0ULL, 0x0ULL, 0x1408142241800000ULL, 0x8ff080808080808ULL, 0x1408142241800000ULL, 0x0ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10ff101010101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10ff101010101000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2810284482010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x10ff101010100000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2810284482000000ULL, 0x0ULL, 0x0ULL, 0x10ff101010000000ULL, 0x0ULL, 0x0ULL, 0x2810284482010000ULL, 0x0ULL, 0x0ULL, 0x2810284480000000ULL, 0x0ULL, 0x10ff101000000000ULL, 0x0ULL, 0x2810284402010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2810284080000000ULL, 0x10ff100000000000ULL, 0x2810280402010000ULL, 0x0ULL, 0x0ULL, 0x10ff101010101010ULL, 0x10fe101010101010ULL, 0x10fc101010101010ULL, 0x10f8101010101010ULL, 0x0ULL, 0x103f101010101010ULL, 0x107f101010101010ULL, 0x10ff101010101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2810284482010000ULL, 0x10ff101010101010ULL, 0x2810284482010000ULL, 0x0ULL, 0x0ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20ff202020202020ULL, 0x0ULL, 0x0ULL, 0x5020508804020100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20ff202020202000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x5020508804020000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x20ff202020200000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x5020508804000000ULL, 0x0ULL, 0x0ULL, 0x20ff202020000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x5020508800000000ULL, 0x0ULL, 0x20ff202000000000ULL, 0x0ULL, 0x5020508804020100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x5020508000000000ULL, 0x20ff200000000000ULL, 0x5020500804020100ULL, 0x0ULL, 0x20ff202020202020ULL, 0x20fe202020202020ULL, 0x20fc202020202020ULL, 0x20f8202020202020ULL, 0x20f0202020202020ULL, 0x0ULL, 0x207f202020202020ULL, 0x20ff202020202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x5020508804020100ULL, 0x20ff202020202020ULL, 0x5020508804020100ULL, 0x0ULL},
-{0xa040a01008040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40ff404040404040ULL, 0x0ULL, 0x0ULL, 0xa040a01008040200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40ff404040404000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a01008040000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40ff404040400000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a01008000000ULL, 0x0ULL, 0x0ULL, 0x40ff404040000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a01000000000ULL, 0x0ULL, 0x40ff404000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a00000000000ULL, 0x40ff400000000000ULL, 0xa040a01008040201ULL, 0x40ff404040404040ULL, 0x40fe404040404040ULL, 0x40fc404040404040ULL, 0x40f8404040404040ULL, 0x40f0404040404040ULL, 0x40e0404040404040ULL, 0x0ULL, 0x40ff404040404040ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xa040a01008040201ULL, 0x40ff404040404040ULL, 0xa040a01008040201ULL},
-{0x0ULL, 0x4080402010080402ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80ff808080808080ULL, 0x0ULL, 0x0ULL, 0x4080402010080400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80ff808080808000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080402010080000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x80ff808080800000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080402010000000ULL, 0x0ULL, 0x0ULL, 0x80ff808080000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080402000000000ULL, 0x0ULL, 0x80ff808000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080400000000000ULL, 0x80ff800000000000ULL, 0x80ff808080808080ULL, 0x80fe808080808080ULL, 0x80fc808080808080ULL, 0x80f8808080808080ULL, 0x80f0808080808080ULL, 0x80e0808080808080ULL, 0x80c0808080808080ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x4080402010080402ULL, 0x80ff808080808080ULL},
-{0xff01010101010101ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040810204080ULL, 0xff01010101010100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040810204000ULL, 0x0ULL, 0xff01010101010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040810200000ULL, 0x0ULL, 0x0ULL, 0xff01010101000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x102040810000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff01010100000000ULL, 0x0ULL, 0x0ULL, 0x102040800000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff01010000000000ULL, 0x0ULL, 0x102040000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff01000000000000ULL, 0x102000000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x301010101010101ULL, 0x701010101010101ULL, 0xf01010101010101ULL, 0x1f01010101010101ULL, 0x3f01010101010101ULL, 0x7f01010101010101ULL, 0xff01010101010101ULL},
-{0x0ULL, 0xff02020202020202ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff02020202020200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x205081020408000ULL, 0x0ULL, 0xff02020202020000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x205081020400000ULL, 0x0ULL, 0x0ULL, 0xff02020202000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x205081020000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff02020200000000ULL, 0x0ULL, 0x0ULL, 0x205081000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff02020000000000ULL, 0x0ULL, 0x205080000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x205081020408000ULL, 0xff02000000000000ULL, 0x205000000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff02020202020202ULL, 0x0ULL, 0x702020202020202ULL, 0xf02020202020202ULL, 0x1f02020202020202ULL, 0x3f02020202020202ULL, 0x7f02020202020202ULL, 0xff02020202020202ULL},
-{0x0ULL, 0x0ULL, 0xff04040404040404ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff04040404040400ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff04040404040000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a112040800000ULL, 0x0ULL, 0x0ULL, 0xff04040404000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a112040000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff04040400000000ULL, 0x0ULL, 0x0ULL, 0x40a112000000000ULL, 0x0ULL, 0x0ULL, 0x40a112040800000ULL, 0x0ULL, 0xff04040000000000ULL, 0x0ULL, 0x40a110000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a102040800000ULL, 0xff04000000000000ULL, 0x40a010000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff04040404040404ULL, 0xfe04040404040404ULL, 0x0ULL, 0xf04040404040404ULL, 0x1f04040404040404ULL, 0x3f04040404040404ULL, 0x7f04040404040404ULL, 0xff04040404040404ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0xff08080808080808ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff08080808080800ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff08080808080000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff08080808000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x814224180000000ULL, 0x814224180000000ULL, 0x0ULL, 0x0ULL, 0xff08080800000000ULL, 0x0ULL, 0x0ULL, 0x814224100000000ULL, 0x0ULL, 0x0ULL, 0x814224080000000ULL, 0x0ULL, 0xff08080000000000ULL, 0x0ULL, 0x814220100000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x814204080000000ULL, 0xff08000000000000ULL, 0x814020100000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff08080808080808ULL, 0xfe08080808080808ULL, 0xfc08080808080808ULL, 0x0ULL, 0x1f08080808080808ULL, 0x3f08080808080808ULL, 0x7f08080808080808ULL, 0xff08080808080808ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff10101010101010ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff10101010101000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff10101010100000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1028448201000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff10101010000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1028448200000000ULL, 0x0ULL, 0x0ULL, 0xff10101000000000ULL, 0x0ULL, 0x0ULL, 0x1028448201000000ULL, 0x0ULL, 0x0ULL, 0x1028448000000000ULL, 0x0ULL, 0xff10100000000000ULL, 0x0ULL, 0x1028440201000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x1028408000000000ULL, 0xff10000000000000ULL, 0x1028040201000000ULL, 0x0ULL, 0x0ULL, 0xff10101010101010ULL, 0xfe10101010101010ULL, 0xfc10101010101010ULL, 0xf810101010101010ULL, 0x0ULL, 0x3f10101010101010ULL, 0x7f10101010101010ULL, 0xff10101010101010ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff20202020202020ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff20202020202000ULL, 0x0ULL, 0x0ULL, 0x2050880402010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff20202020200000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2050880402000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff20202020000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2050880400000000ULL, 0x0ULL, 0x0ULL, 0xff20202000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2050880000000000ULL, 0x0ULL, 0xff20200000000000ULL, 0x0ULL, 0x2050880402010000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x2050800000000000ULL, 0xff20000000000000ULL, 0x2050080402010000ULL, 0x0ULL, 0xff20202020202020ULL, 0xfe20202020202020ULL, 0xfc20202020202020ULL, 0xf820202020202020ULL, 0xf020202020202020ULL, 0x0ULL, 0x7f20202020202020ULL, 0xff20202020202020ULL},
-{0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff40404040404040ULL, 0x0ULL, 0x40a0100804020100ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff40404040404000ULL, 0x0ULL, 0x0ULL, 0x40a0100804020000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff40404040400000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a0100804000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff40404040000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a0100800000000ULL, 0x0ULL, 0x0ULL, 0xff40404000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a0100000000000ULL, 0x0ULL, 0xff40400000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x40a0000000000000ULL, 0xff40000000000000ULL, 0x40a0100804020100ULL, 0xff40404040404040ULL, 0xfe40404040404040ULL, 0xfc40404040404040ULL, 0xf840404040404040ULL, 0xf040404040404040ULL, 0xe040404040404040ULL, 0x0ULL, 0xff40404040404040ULL},
-{0x8040201008040201ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff80808080808080ULL, 0x0ULL, 0x8040201008040200ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff80808080808000ULL, 0x0ULL, 0x0ULL, 0x8040201008040000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff80808080800000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040201008000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0xff80808080000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040201000000000ULL, 0x0ULL, 0x0ULL, 0xff80808000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040200000000000ULL, 0x0ULL, 0xff80800000000000ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x0ULL, 0x8040000000000000ULL, 0xff80000000000000ULL, 0xff80808080808080ULL, 0xfe80808080808080ULL, 0xfc80808080808080ULL, 0xf880808080808080ULL, 0xf080808080808080ULL, 0xe080808080808080ULL, 0xc080808080808080ULL, 0x0ULL}};
-
-uint64_t slide(uint64_t result, uint64_t occupied, uint64_t pieceIndex) {
-    for (uint64_t temp = result & occupied; temp; temp = _blsr_u64(temp)) {
-        result &= attacking[pieceIndex][_tzcnt_u64(temp)];
+#include "lookup.h"
+
+alignas(64) uint64_t sliderAttacks[107648];
+
+void initSliders(void) {
+    for (int rook = 1; rook >= 0; rook--) {
+        for (int square = 0; square < 64; square++) {
+            uint64_t mask = rook ? rookMask[square] : bishopMask[square];
+            uint64_t offset = rook ? rookOffset[square] : bishopOffset[square];
+
+            uint64_t subset = 0;
+            do { // carry-rippler over all subsets of the mask
+                sliderAttacks[offset + (rook ? rookIndex(subset, square) : bishopIndex(subset, square))] = rayWalk(square, subset, rook, false);
+                subset = (subset - mask) & mask;
+            } while (subset);
+        }
     }
-    return result;
 }
+
+static struct SliderInit { SliderInit() { initSliders(); } } sliderInit;
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <bit>
+#include <array>
+#include <cstdint>
+#include <immintrin.h>
+
+// attack and ray tables, computed at compile time and kept in read-only memory. Only the slider
+// attack table is filled at startup, by lookup.cpp
+
+using Table64 = std::array<uint64_t, 64>;
+
+// N, S, E, W, NE, SW, NW, SE: the opposite of direction d is d ^ 1
+constexpr int dirRow[8] {1, -1, 0, 0, 1, -1, 1, -1};
+constexpr int dirCol[8] {0, 0, 1, -1, 1, -1, -1, 1};
+#define NO_DIRECTION 8 // squares that do not share a line, selects an empty ray
+
+constexpr bool onBoard(int row, int col) { return row >= 0 && row < 8 && col >= 0 && col < 8; }
+
+// rook (directions 0-3) or bishop (4-7) rays from square, each one up to and including the first occupied
+// square. trimEdge leaves out the last square of every ray, which gives the relevant occupancy mask
+constexpr uint64_t rayWalk(int square, uint64_t occupied, bool rook, bool trimEdge) {
+    uint64_t result = 0;
+    for (int d = rook ? 0 : 4; d < (rook ? 4 : 8); d++) {
+        int row = square / 8 + dirRow[d], col = square % 8 + dirCol[d];
+        while (onBoard(row, col)) {
+            int nrow = row + dirRow[d], ncol = col + dirCol[d];
+            if (trimEdge && !onBoard(nrow, ncol)) break;
+            result |= 1ULL << (row * 8 + col);
+            if (occupied >> (row * 8 + col) & 1) break;
+            row = nrow; col = ncol;
+        }
+    }
+    return result;
+}
+
+constexpr Table64 generateLeaper(const int (&dr)[8], const int (&dc)[8]) {
+    Table64 table {};
+    for (int square = 0; square < 64; square++) {
+        for (int i = 0; i < 8; i++) {
+            int row = square / 8 + dr[i], col = square % 8 + dc[i];
+            if (onBoard(row, col)) table[square] |= 1ULL << (row * 8 + col);
+        }
+    }
+    return table;
+}
+
+constexpr std::array<Table64, 9> generateRays() {
+    std::array<Table64, 9> rays {}; // rays[NO_DIRECTION] stays empty
+    for (int d = 0; d < 8; d++) {
+        for (int square = 0; square < 64; square++) {
+            for (int row = square / 8 + dirRow[d], col = square % 8 + dirCol[d]; onBoard(row, col); row += dirRow[d], col += dirCol[d]) {
+                rays[d][square] |= 1ULL << (row * 8 + col);
+            }
+        }
+    }
+    return rays;
+}
+
+constexpr Table64 generateSquares() {
+    Table64 table {};
+    for (int square = 0; square < 64; square++) table[square] = 1ULL << square;
+    return table;
+}
+
+constexpr int kingRow[8] {1, 1, 1, 0, 0, -1, -1, -1};
+constexpr int kingCol[8] {-1, 0, 1, -1, 1, -1, 0, 1};
+constexpr int knightRow[8] {2, 2, 1, 1, -1, -1, -2, -2};
+constexpr int knightCol[8] {-1, 1, -2, 2, -2, 2, -1, 1};
+
+alignas(64) inline constexpr Table64 positionToBit = generateSquares();
+alignas(64) inline constexpr Table64 kingMoves = generateLeaper(kingRow, kingCol);
+alignas(64) inline constexpr Table64 knightMoves = generateLeaper(knightRow, knightCol);
+
+// rays[d][square]: squares from square in direction d up to the edge, without square itself
+alignas(64) inline constexpr std::array<Table64, 9> rays = generateRays();
+
+constexpr Table64 generateLines(int first, int last) {
+    Table64 table {};
+    for (int square = 0; square < 64; square++) {
+        for (int d = first; d < last; d++) table[square] |= rays[d][square];
+    }
+    return table;
+}
+
+alignas(64) inline constexpr Table64 rookMoves = generateLines(0, 4);
+alignas(64) inline constexpr Table64 bishopMoves = generateLines(4, 8);
+alignas(64) inline constexpr Table64 queenMoves = generateLines(0, 8);
+
+constexpr std::array<std::array<uint8_t, 64>, 64> generateDirections() {
+    std::array<std::array<uint8_t, 64>, 64> directions {};
+    for (auto &row : directions) row.fill(NO_DIRECTION);
+    for (int d = 0; d < 8; d++) {
+        for (int square = 0; square < 64; square++) {
+            for (uint64_t temp = rays[d][square]; temp; temp &= temp - 1) directions[square][std::countr_zero(temp)] = d;
+        }
+    }
+    return directions;
+}
+
+// directions[from][to]: direction of the line from one square to the other, NO_DIRECTION if there is none.
+// 4 KB, replacing the 32 KB square by square PinBetween, CheckBetween and attacking tables
+alignas(64) inline constexpr std::array<std::array<uint8_t, 64>, 64> directions = generateDirections();
+
+// squares between king and piece plus the piece square, 0 when they do not share a line
+inline uint64_t pinRay(uint64_t king, uint64_t piece) {
+    int d = directions[king][piece];
+    return rays[d][king] ^ rays[d][piece];
+}
+
+// squares on the far side of the king from a slider giving check along a line, where the king cannot step
+inline uint64_t behindKing(uint64_t king, uint64_t piece) {
+    return rays[directions[king][piece] ^ 1][king];
+}
+
+// squares behind blocker as seen from square, which the blocker hides from a slider on square
+inline uint64_t beyond(uint64_t square, uint64_t blocker) {
+    return rays[directions[square][blocker]][blocker];
+}
+
+// slider attack backends, selected at compile time:
+//   SLIDER_PEXT  - BMI2 _pext_u64 indexing (default when compiled with BMI2)
+//   SLIDER_MAGIC - fancy magic multiply/shift, for CPUs with microcoded pext (Zen 1/2)
+//   SLIDER_LOOP  - original blocker loop, clearing the ray behind every blocker
+#if !defined(SLIDER_PEXT) && !defined(SLIDER_MAGIC) && !defined(SLIDER_LOOP)
+#ifdef __BMI2__
+#define SLIDER_PEXT
+#else
+#define SLIDER_MAGIC
+#endif
+#endif
+
+alignas(64) inline constexpr Table64 rookMagics {0x1080004008801020ULL, 0x0840092002c03000ULL, 0x1900200010400900ULL, 0x0880100008000480ULL,
+    0x4200100420080200ULL, 0x8100020100080400ULL, 0x0200040110886200ULL, 0x0200008040220411ULL,
+    0x0404800084400220ULL, 0x0000401000402000ULL, 0x0086001081220440ULL, 0x0408800800100280ULL,
+    0x000a001201040820ULL, 0x8848800200840080ULL, 0x4001000100040200ULL, 0x0442000102105084ULL,
+    0x9080010020804100ULL, 0x0040404000201009ULL, 0x0000808010002009ULL, 0x2200090021d00100ULL,
+    0x0008008008040080ULL, 0x0004004002010040ULL, 0x0011040008015042ULL, 0x00000a0001768104ULL,
+    0x0000800080204009ULL, 0x2010004140002001ULL, 0x9800200280100080ULL, 0x1000100080080080ULL,
+    0x0442000a00049020ULL, 0x2100040080020080ULL, 0x0800120400900148ULL, 0x0010040a00128541ULL,
+    0x2800804000800030ULL, 0x1010002000400041ULL, 0x4000200011004100ULL, 0x0610008410800800ULL,
+    0x0400802402800800ULL, 0xc100020080800400ULL, 0x0002000802000401ULL, 0x0182085882000401ULL,
+    0x0220204000808000ULL, 0x2860100040024022ULL, 0x0001002004110040ULL, 0x99101042000a0020ULL,
+    0x0004080004008080ULL, 0x0010040002008080ULL, 0x2012004881020004ULL, 0x8300842444820011ULL,
+    0x0088403882010200ULL, 0x0820400080210100ULL, 0x0110910040a00300ULL, 0x0801100280080480ULL,
+    0x0242009008200600ULL, 0x1002000489500200ULL, 0x0040800200010080ULL, 0x0091800041000080ULL,
+    0x0000209300488001ULL, 0x04c1002414824001ULL, 0x020020000b001041ULL, 0x7000100004200901ULL,
+    0x8002002004100802ULL, 0x30010002084c0007ULL, 0x0888221800813004ULL, 0x4000002840840112ULL};
+
+alignas(64) inline constexpr Table64 bishopMagics {0xa010041108003100ULL, 0x006082020a002900ULL, 0x6810010619200000ULL, 0x08281a0520000408ULL,
+    0x0001104001000400ULL, 0x0018901008048400ULL, 0x00040a0210245280ULL, 0x000200210808a402ULL,
+    0x9140048410821200ULL, 0x0800091010820041ULL, 0x20504804832202c0ULL, 0x0100091401081000ULL,
+    0x8021011140000012ULL, 0x0810020804450400ULL, 0x208b0542109008a2ULL, 0x0080084a08040204ULL,
+    0x0040e2a80811244cULL, 0x2505022008008108ULL, 0x0430220100420040ULL, 0x010a040420220040ULL,
+    0x1105000290400000ULL, 0x0093001200822120ULL, 0x4000a62048043004ULL, 0x280120048a015004ULL,
+    0x006090002a020814ULL, 0x44042000240800d0ULL, 0x01102800040a4400ULL, 0x1004080080220040ULL,
+    0x0001001011004024ULL, 0x0010044000805040ULL, 0x0914041200820100ULL, 0x0004821012821480ULL,
+    0x0024040500c05021ULL, 0x0088611002080200ULL, 0x0116080a00040020ULL, 0x4000020080080080ULL,
+    0x2450450140840040ULL, 0x0000880201484100ULL, 0x0222020404020092ULL, 0x8081110600002e00ULL,
+    0x2842101105000801ULL, 0x1100809008001025ULL, 0x00020202221c0400ULL, 0x0422014022009020ULL,
+    0x0210046102100c00ULL, 0xc004008082029102ULL, 0x00aa461801101200ULL, 0x0404080080201108ULL,
+    0x020542108c205002ULL, 0x0410544804100100ULL, 0x0040910841100000ULL, 0x0400200042021100ULL,
+    0x00004204850400c0ULL, 0x0200100410a42102ULL, 0x1040020801210102ULL, 0x0805040410420000ULL,
+    0x2884804130100200ULL, 0x800c262201242000ULL, 0x1058000194108800ULL, 0x0014221054420204ULL,
+    0x0104000012a02200ULL, 0x0200881003300100ULL, 0x0140400202840100ULL, 0x0402020801010201ULL};
+
+constexpr Table64 generateMasks(bool rook) {
+    Table64 table {};
+    for (int square = 0; square < 64; square++) table[square] = rayWalk(square, 0, rook, true);
+    return table;
+}
+
+alignas(64) inline constexpr Table64 rookMask = generateMasks(true); // relevant occupancy, rays without the board edge
+alignas(64) inline constexpr Table64 bishopMask = generateMasks(false);
+
+constexpr Table64 generateOffsets(const Table64 &masks, uint64_t offset) {
+    Table64 table {};
+    for (int square = 0; square < 64; square++) {
+        table[square] = offset;
+        offset += 1ULL << std::popcount(masks[square]);
+    }
+    return table;
+}
+
+alignas(64) inline constexpr Table64 rookOffset = generateOffsets(rookMask, 0);
+alignas(64) inline constexpr Table64 bishopOffset = generateOffsets(bishopMask, 102400);
+
+alignas(64) extern uint64_t sliderAttacks[107648]; // 102400 rook entries followed by 5248 bishop entries
+
+void initSliders(void); // fills sliderAttacks, runs during static initialisation of lookup.cpp
+
+constexpr std::array<uint8_t, 64> generateShifts(const Table64 &masks) {
+    std::array<uint8_t, 64> table {};
+    for (int square = 0; square < 64; square++) table[square] = 64 - std::popcount(masks[square]);
+    return table;
+}
+
+// 64 - relevant bits, the shift of the magic product, stored next to the magics instead of recounted per lookup
+alignas(64) inline constexpr std::array<uint8_t, 64> rookShift = generateShifts(rookMask);
+alignas(64) inline constexpr std::array<uint8_t, 64> bishopShift = generateShifts(bishopMask);
+
+// index of occupied into the table of square, within the square's block of sliderAttacks
+inline uint64_t rookIndex(uint64_t occupied, uint64_t square) {
+#ifdef SLIDER_PEXT
+    return _pext_u64(occupied, rookMask[square]);
+#else
+    return ((occupied & rookMask[square]) * rookMagics[square]) >> rookShift[square];
+#endif
+}
+
+inline uint64_t bishopIndex(uint64_t occupied, uint64_t square) {
+#ifdef SLIDER_PEXT
+    return _pext_u64(occupied, bishopMask[square]);
+#else
+    return ((occupied & bishopMask[square]) * bishopMagics[square]) >> bishopShift[square];
+#endif
+}
+
+inline uint64_t rookSlide(uint64_t occupied, uint64_t pieceIndex) {
+#ifdef SLIDER_LOOP
+    uint64_t result = rookMoves[pieceIndex];
+    for (uint64_t temp = result & occupied; temp; temp = _blsr_u64(temp)) result &= ~beyond(pieceIndex, _tzcnt_u64(temp));
+    return result;
+#else
+    return sliderAttacks[rookOffset[pieceIndex] + rookIndex(occupied, pieceIndex)];
+#endif
+}
+
+inline uint64_t bishopSlide(uint64_t occupied, uint64_t pieceIndex) {
+#ifdef SLIDER_LOOP
+    uint64_t result = bishopMoves[pieceIndex];
+    for (uint64_t temp = result & occupied; temp; temp = _blsr_u64(temp)) result &= ~beyond(pieceIndex, _tzcnt_u64(temp));
+    return result;
+#else
+    return sliderAttacks[bishopOffset[pieceIndex] + bishopIndex(occupied, pieceIndex)];
+#endif
+}
+
+// result is any subset of the rook/bishop rays of pieceIndex (callers pass rookMoves or bishopMoves),
+// each call site only ever takes one of the two branches, so both are perfectly predicted
+inline uint64_t slide(uint64_t result, uint64_t occupied, uint64_t pieceIndex) {
+#ifdef SLIDER_LOOP
+    for (uint64_t temp = result & occupied; temp; temp = _blsr_u64(temp)) {
+        result &= ~beyond(pieceIndex, _tzcnt_u64(temp));
+    }
+    return result;
+#else
+    uint64_t seen = 0;
+    if (result & rookMoves[pieceIndex]) seen |= rookSlide(occupied, pieceIndex);
+    if (result & bishopMoves[pieceIndex]) seen |= bishopSlide(occupied, pieceIndex);
+    return seen & result;
+#endif
+}
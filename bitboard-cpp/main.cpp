@@ -1,10 +1,22 @@
-#include "bitboard.cpp"
+#include "bitboard.h"
+#include "perft.h"
+#include "parallel.h"
+#include "fen.h"
+#include "stats.h"
+#include "packed.h"
+#include "pgn.h"
+#include "mapped.h"
 
 #include <vector>
 #include <string>
 #include <cstdint>
 #include <iostream>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <algorithm>
+#include <iterator>
 
 const char PIECES[13][4] { "♔", // index 0
     "♕", "♖", "♗", "♘", "♙", "♚", "♛", "♜", "♝", "♞", "♟", " " // index 12
@@ -30,114 +42,9 @@ void print_uint64t(uint64_t num) {
     std::cout << std::endl;
 }
 
-Board parseFEN(const std::string& fen) {
-    bool ep = 0;
-    bool wL = 0;
-    bool wR = 0;
-    bool bL = 0;
-    bool bR = 0;
-    bool isWhite = false;
-
-    Pieces white = {0, 0, 0, 0, 0, 0};
-    Pieces black = {0, 0, 0, 0, 0, 0};
-    uint64_t enp = 0;
-
-    // Parsing pieces
-    int row = 7, col = 0;
-
-    uint64_t position = 0;
-    uint64_t string_position = 0;
-    for (auto c : fen) {
-        string_position++;
-        if (position >= 64) break;
-        if (c == '/') {
-            row--;
-            col = 0;
-            continue;
-        }
-        if (isdigit(c)) {
-            col += c - '0';
-            position += c - '0';
-        } else {
-            uint64_t square = 1ULL << (row * 8 + col);
-            switch (c) {
-                case 'K':
-                    white.k |= square;
-                    break;
-                case 'Q':
-                    white.q |= square;
-                    break;
-                case 'R':
-                    white.r |= square;
-                    break;
-                case 'B':
-                    white.b |= square;
-                    break;
-                case 'N':
-                    white.n |= square;
-                    break;
-                case 'P':
-                    white.p |= square;
-                    break;
-                case 'k':
-                    black.k |= square;
-                    break;
-                case 'q':
-                    black.q |= square;
-                    break;
-                case 'r':
-                    black.r |= square;
-                    break;
-                case 'b':
-                    black.b |= square;
-                    break;
-                case 'n':
-                    black.n |= square;
-                    break;
-                case 'p':
-                    black.p |= square;
-                    break;
-                default:
-                    break;
-            }
-            col++;
-            position++;
-        }
-    }
-
-    if (fen[string_position] == 'w') {
-        isWhite = true;
-    }
-    string_position+=2;
-
-    while (fen[string_position] != ' ') {
-        switch (fen[string_position])
-        {
-        case 'K':
-            wL = true;
-            break;
-        case 'Q':
-            wR = true;
-            break;
-        case 'k':
-            bL = true;
-            break;
-        case 'q':
-            bR = true;
-            break;        
-        default:
-            break;
-        }
-        string_position++;
-    }
-    // ep TODO
-    return {white, black, enp, {ep, wL, wR, bL, bR, isWhite}};
-}
-
 void displayBoard(const Board& board) {
     Squares wocc = board.w.occupied();
     Squares bocc = board.b.occupied();
-    Squares occupied = wocc | bocc;
 
     for (int row=7; row>=0; row--) {
         for (int col=0; col<8; col++) {
@@ -178,75 +85,6 @@ void displayBoard(const Board& board) {
     std::cout << std::endl;
 }
 
-using FunctionPtr = std::vector<Board>(*)(Board&);
-
-FunctionPtr functionArray[64] = {
-    generateMoves<0, 0, 0, 0, 0, 0>,
-    generateMoves<1, 0, 0, 0, 0, 0>,
-    generateMoves<0, 1, 0, 0, 0, 0>,
-    generateMoves<1, 1, 0, 0, 0, 0>,
-    generateMoves<0, 0, 1, 0, 0, 0>,
-    generateMoves<1, 0, 1, 0, 0, 0>,
-    generateMoves<0, 1, 1, 0, 0, 0>,
-    generateMoves<1, 1, 1, 0, 0, 0>,
-    generateMoves<0, 0, 0, 1, 0, 0>,
-    generateMoves<1, 0, 0, 1, 0, 0>,
-    generateMoves<0, 1, 0, 1, 0, 0>,
-    generateMoves<1, 1, 0, 1, 0, 0>,
-    generateMoves<0, 0, 1, 1, 0, 0>,
-    generateMoves<1, 0, 1, 1, 0, 0>,
-    generateMoves<0, 1, 1, 1, 0, 0>,
-    generateMoves<1, 1, 1, 1, 0, 0>,
-    generateMoves<0, 0, 0, 0, 1, 0>,
-    generateMoves<1, 0, 0, 0, 1, 0>,
-    generateMoves<0, 1, 0, 0, 1, 0>,
-    generateMoves<1, 1, 0, 0, 1, 0>,
-    generateMoves<0, 0, 1, 0, 1, 0>,
-    generateMoves<1, 0, 1, 0, 1, 0>,
-    generateMoves<0, 1, 1, 0, 1, 0>,
-    generateMoves<1, 1, 1, 0, 1, 0>,
-    generateMoves<0, 0, 0, 1, 1, 0>,
-    generateMoves<1, 0, 0, 1, 1, 0>,
-    generateMoves<0, 1, 0, 1, 1, 0>,
-    generateMoves<1, 1, 0, 1, 1, 0>,
-    generateMoves<0, 0, 1, 1, 1, 0>,
-    generateMoves<1, 0, 1, 1, 1, 0>,
-    generateMoves<0, 1, 1, 1, 1, 0>,
-    generateMoves<1, 1, 1, 1, 1, 0>,
-    generateMoves<0, 0, 0, 0, 0, 1>,
-    generateMoves<1, 0, 0, 0, 0, 1>,
-    generateMoves<0, 1, 0, 0, 0, 1>,
-    generateMoves<1, 1, 0, 0, 0, 1>,
-    generateMoves<0, 0, 1, 0, 0, 1>,
-    generateMoves<1, 0, 1, 0, 0, 1>,
-    generateMoves<0, 1, 1, 0, 0, 1>,
-    generateMoves<1, 1, 1, 0, 0, 1>,
-    generateMoves<0, 0, 0, 1, 0, 1>,
-    generateMoves<1, 0, 0, 1, 0, 1>,
-    generateMoves<0, 1, 0, 1, 0, 1>,
-    generateMoves<1, 1, 0, 1, 0, 1>,
-    generateMoves<0, 0, 1, 1, 0, 1>,
-    generateMoves<1, 0, 1, 1, 0, 1>,
-    generateMoves<0, 1, 1, 1, 0, 1>,
-    generateMoves<1, 1, 1, 1, 0, 1>,
-    generateMoves<0, 0, 0, 0, 1, 1>,
-    generateMoves<1, 0, 0, 0, 1, 1>,
-    generateMoves<0, 1, 0, 0, 1, 1>,
-    generateMoves<1, 1, 0, 0, 1, 1>,
-    generateMoves<0, 0, 1, 0, 1, 1>,
-    generateMoves<1, 0, 1, 0, 1, 1>,
-    generateMoves<0, 1, 1, 0, 1, 1>,
-    generateMoves<1, 1, 1, 0, 1, 1>,
-    generateMoves<0, 0, 0, 1, 1, 1>,
-    generateMoves<1, 0, 0, 1, 1, 1>,
-    generateMoves<0, 1, 0, 1, 1, 1>,
-    generateMoves<1, 1, 0, 1, 1, 1>,
-    generateMoves<0, 0, 1, 1, 1, 1>,
-    generateMoves<1, 0, 1, 1, 1, 1>,
-    generateMoves<0, 1, 1, 1, 1, 1>,
-    generateMoves<1, 1, 1, 1, 1, 1>,
-};
-
 void findMove(Board &initial, Board &newpos) {
     Squares iwocc = initial.w.occupied();
     Squares ibocc = initial.b.occupied();
@@ -280,22 +118,24 @@ void findMove(Board &initial, Board &newpos) {
     std::cout << ": ";
 }
 
-uint64_t perft(int depth, Board &initial, int printDepth) {
-
-    uint64_t counts = 0;
-    uint64_t currCount = 0;
-
-    uint8_t currState = initial.state.stateToInt();
-
-    auto moves = functionArray[initial.state.stateToInt()](initial);
-    if (depth==1) return moves.size();
-
-    for (auto newpos : moves) {
-        currCount = perft(depth-1, newpos, printDepth);
-        counts += currCount;
-    }
+std::string moveToString(Move m) {
+    std::string inttoletter = "abcdefgh";
+    std::string promotion = " qrbn"; // indexed by QUEEN, ROOK, BISHOP, KNIGHT
+
+    std::string out;
+    out += inttoletter[m.from() % 8];
+    out += '1' + m.from() / 8;
+    out += inttoletter[m.to() % 8];
+    out += '1' + m.to() / 8;
+    if (m.promotion()) out += promotion[m.promotion()];
+    return out;
+}
 
-    return counts;
+void printTableStats(void) {
+    if (!perftTable.enabled()) return;
+    uint64_t probes = perftTable.probeCount();
+    uint64_t hits = perftTable.hitCount();
+    std::cout << "Hash: " << hits << " hits / " << probes << " probes (" << (probes ? 100.0 * hits / probes : 0.0) << "%), fill " << 100.0 * perftTable.fill() << "%" << std::endl;
 }
 
 int charToCol(char c) {
@@ -362,7 +202,7 @@ void cli(void) {
     std::string input;
     while (true) {
         std::cout << "> ";
-        getline(std::cin, input);
+        if (!getline(std::cin, input)) break; // end of input, instead of spinning on the failed stream
 
         switch (input[0])
         {
@@ -480,34 +320,88 @@ void cli(void) {
             }
         case 'p': // print
             displayBoard(board);
+            std::cout << toFEN(board) << std::endl;
             break;
         case 'e': // eval, will be e (number)
             {   
                 int perftn = atoi(input.substr(2, input.size()-2).c_str());
 
+                perftTable.clearStats();
                 auto start_time = std::chrono::high_resolution_clock::now();
-                uint64_t tot = perft(perftn, board, perftn);
+                uint64_t tot = perft(perftn, board);
                 auto end_time = std::chrono::high_resolution_clock::now();
 
                 std::cout << "Total: " << tot << std::endl;
                 auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
                 std::cout << "Execution time: " << duration.count() << " microseconds" << std::endl;
+                printTableStats();
                 break;
             }
         case 'n': // eval, will be e (number)
             {   
                 int perftn = atoi(input.substr(2, input.size()-2).c_str());
-                uint64_t tot = perft(perftn, board, 200);
+                perftTable.clearStats();
+                uint64_t tot = perft(perftn, board);
                 std::cout << "Total: " << tot << std::endl;
+                printTableStats();
+                break;
+            }
+        case 'd': // divide, d DEPTH: perft of every legal move
+            {
+                int perftn = atoi(input.substr(2, input.size()-2).c_str());
+                uint64_t tot = divide(perftn, board, [](Move move, uint64_t nodes) {
+                    std::cout << moveToString(move) << ": " << nodes << std::endl;
+                });
+                std::cout << "Total: " << tot << std::endl;
+                break;
+            }
+        case 't': // parallel perft, t DEPTH THREADS [SPLIT_DEPTH]
+            {
+                int perftn = 0, threads = 1, split = 2;
+                sscanf(input.c_str() + 1, "%d %d %d", &perftn, &threads, &split);
+
+                WorkStealingPool pool(threads);
+                perftTable.clearStats();
+                auto start_time = std::chrono::high_resolution_clock::now();
+                uint64_t tot = parallelPerft(perftn, board, pool, split);
+                auto end_time = std::chrono::high_resolution_clock::now();
+
+                std::cout << "Total: " << tot << std::endl;
+                auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+                std::cout << "Execution time: " << duration.count() << " microseconds (" << pool.size() << " threads)" << std::endl;
+                printTableStats();
+                break;
+            }
+        case 'h': // perft hash table size, h SIZE_MB (0 disables it)
+            {
+                perftTable.resize(atoi(input.substr(2, input.size()-2).c_str()));
+                std::cout << "Hash: " << perftTable.sizeBytes() / (1024 * 1024) << " MB" << std::endl;
+                break;
+            }
+        case 'g': // lists the legal moves, numbered as l expects them
+            {
+                Move moves[MAX_MOVES];
+                int count = generateMoveList(board, moves);
+                for (int i = 0; i < count; i++) {
+                    std::cout << i << ": " << moveToString(moves[i]);
+                    if (moves[i].isCapture()) std::cout << " x";
+                    std::cout << std::endl;
+                }
                 break;
             }
         case 'l':
             {
-                auto moves = functionArray[board.state.stateToInt()](board);
+                auto moves = generateMoves(board);
                 int perftn = atoi(input.substr(2, input.size()-2).c_str());
                 board = moves[perftn];
                 break;
             }
+        case 's': // instrumentation counters since the last s, as JSON (BITBOARD_STATS builds)
+            {
+                dumpStats(std::cout);
+                clearStats();
+                break;
+            }
         default:
             std::cout << "Ignore " << input << std::endl;
             break;
@@ -517,9 +411,233 @@ void cli(void) {
 
 
 
-int main() {
+// the FEN of an EPD line ends at the first ';', a plain FEN line is used whole
+std::string lineFEN(const std::string &line) {
+    std::string fen = line.substr(0, line.find(';'));
+    return fen.substr(0, fen.find_last_not_of(" \t\r") + 1);
+}
+
+// result of one batch line, the FEN followed by ";D<depth> <nodes>" for perft and count (which is depth 1)
+// or ";moves <move> ..." for moves, so the output of perft is an EPD file bench can check against. A line
+// readFEN rejects gets ";error <field> at <offset>"
+std::string batchLine(const std::string &line, const std::string &op, int depth) {
+    std::string fen = lineFEN(line);
+    Board board;
+    FenStatus status = readFEN(fen, board);
+    if (status.error != FEN_OK) return fen + " ;error " + fenErrorName(status.error) + " at " + std::to_string(status.offset) + '\n';
+
+    std::string res = fen.substr(0, status.offset);
+    if (op == "moves") {
+        Move moves[MAX_MOVES];
+        int count = generateMoveList(board, moves);
+        res += " ;moves";
+        for (int i = 0; i < count; i++) res += ' ' + moveToString(moves[i]);
+    } else if (op == "count") {
+        res += " ;D1 " + std::to_string(countLegal(board));
+    } else {
+        res += " ;D" + std::to_string(depth) + ' ' + std::to_string(perft(depth, board));
+    }
+    res += '\n';
+    return res;
+}
+
+// FEN or EPD lines to a PackedBoard file; the EPD operations are dropped and lines readFEN rejects skipped
+int packLines(std::istream &in, const std::string &output) {
+    PackedWriter writer(output);
+    if (!writer.ok()) {
+        std::cerr << "Error: cannot write " << output << std::endl;
+        return 2;
+    }
+    std::string line;
+    uint64_t number = 0, rejected = 0;
+    while (getline(in, line)) {
+        number++;
+        std::string fen = lineFEN(line);
+        if (fen.empty() || fen[0] == '#') continue;
+        Board board;
+        FenClocks clocks;
+        FenStatus status = readFEN(fen, board, &clocks);
+        if (status.error != FEN_OK || !writer.write(board, clocks)) {
+            std::cerr << "line " << number << ": skipped, " << (status.error != FEN_OK ? fenErrorName(status.error) : "more than 32 pieces") << std::endl;
+            rejected++;
+        }
+    }
+    if (!writer.close()) {
+        std::cerr << "Error: writing " << output << " failed" << std::endl;
+        return 2;
+    }
+    std::cerr << writer.size() << " positions packed, " << rejected << " skipped" << std::endl;
+    return 0;
+}
+
+// a PackedBoard file back to FEN lines with their clocks
+int unpackFile(const std::string &path) {
+    PackedReader reader(path);
+    if (!reader.ok()) {
+        std::cerr << "Error: " << path << " is not a packed position file" << std::endl;
+        return 2;
+    }
+    std::string out;
+    char fen[MAX_FEN];
+    for (size_t i = 0; i < reader.size(); i++) {
+        Board board;
+        FenClocks clocks;
+        if (!reader.board(i, board, &clocks)) {
+            std::cerr << "Error: record " << i << " is corrupt" << std::endl;
+            return 2;
+        }
+        out.append(fen, writeFEN(board, fen, clocks));
+        out += '\n';
+        if (out.size() > (1 << 20)) {
+            std::cout.write(out.data(), out.size());
+            out.clear();
+        }
+    }
+    std::cout.write(out.data(), out.size());
+    std::cout.flush();
+    return 0;
+}
+
+// the positions of one game, a FEN or a hash per line, and a ";error <kind> at <offset>" line with the offset in
+// the file when the game stops early
+std::string replayLines(std::string_view game, size_t offset, bool hashes, uint64_t &plies, uint64_t &errors) {
+    std::string out;
+    char line[MAX_FEN + 1];
+    PgnStatus status = replayGame(game, [&](const Board &board, FenClocks clocks) {
+        size_t length = hashes ? snprintf(line, sizeof(line), "%016llx", (unsigned long long) board.hash) : writeFEN(board, line, clocks);
+        line[length] = '\n';
+        out.append(line, length + 1);
+    });
+    if (status.error != PGN_OK) {
+        out += ";error " + std::string(pgnErrorName(status.error)) + " at " + std::to_string(offset + status.offset) + '\n';
+        errors++;
+    }
+    out += '\n';
+    plies += status.plies;
+    return out;
+}
+
+// bitboard pgn [fen|hash] [-f FILE] [-t THREADS]: every game of the PGN file, mapped, or stdin, replayed on the
+// pool and its positions written in input order, a blank line after each game
+int replayPGN(const std::string &path, bool hashes, int threads) {
+    std::string input;
+    MappedFile file(path.empty() ? std::string() : path);
+    if (!path.empty() && !file.ok()) {
+        std::cerr << "Error: cannot read " << path << std::endl;
+        return 2;
+    }
+    if (path.empty()) input.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+    else file.sequential();
+    std::string_view text = path.empty() ? std::string_view(input) : file.view();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::string_view> games = splitGames(text);
+    constexpr size_t CHUNK = 4096, JOB = 16; // games per chunk, games per pool job
+    std::vector<std::string> results(CHUNK);
+    std::vector<uint64_t> plies((CHUNK + JOB - 1) / JOB), errors(plies.size());
+    uint64_t totalPlies = 0, totalErrors = 0;
+    WorkStealingPool pool(threads);
+    std::string out;
+    for (size_t first = 0; first < games.size(); first += CHUNK) {
+        size_t count = std::min(CHUNK, games.size() - first);
+        pool.run((count + JOB - 1) / JOB, [&](size_t job) {
+            plies[job] = errors[job] = 0;
+            for (size_t j = job * JOB; j < std::min(count, (job + 1) * JOB); j++) {
+                std::string_view game = games[first + j];
+                results[j] = replayLines(game, game.data() - text.data(), hashes, plies[job], errors[job]);
+            }
+        });
+        out.clear();
+        for (size_t j = 0; j < count; j++) out += results[j];
+        std::cout.write(out.data(), out.size());
+        for (size_t job = 0; job < (count + JOB - 1) / JOB; job++) {
+            totalPlies += plies[job];
+            totalErrors += errors[job];
+        }
+    }
+    std::cout.flush();
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    std::cerr << games.size() << " games, " << totalPlies << " plies, " << totalErrors << " with errors in " << seconds << " s, "
+              << (seconds > 0 ? games.size() / seconds : 0.0) << " games/s (" << pool.size() << " threads)" << std::endl;
+    return totalErrors ? 1 : 0;
+}
+
+// non-interactive mode, bitboard perft DEPTH|count|moves [-f FILE] [-t THREADS]. Every line of FILE (stdin by
+// default) is a FEN or an EPD line. Lines are read in chunks, a chunk runs on the pool and its results are
+// written in input order with one write, and the throughput goes to stderr.
+// bitboard pack OUTPUT [-f FILE] converts the lines to a PackedBoard file, bitboard unpack -f FILE back to FENs,
+// bitboard pgn replays the games of a PGN file, see replayPGN
+int batch(int argc, char **argv) {
+    std::string op = argv[1];
+    std::string path, output;
+    int depth = 1;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    int i = 2;
+    if (op == "perft" && i < argc) depth = atoi(argv[i++]);
+    if (op == "pack" && i < argc) output = argv[i++];
+    if (op == "pgn" && i < argc && argv[i][0] != '-') output = argv[i++];
+    for (; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue) path = argv[++i];
+        else if (arg == "-t" && hasValue) threads = atoi(argv[++i]);
+        else op.clear();
+    }
+    if (op == "unpack" && !path.empty()) return unpackFile(path);
+    if (op == "pgn" && (output.empty() || output == "fen" || output == "hash")) return replayPGN(path, output == "hash", threads);
+    if (op != "perft" && op != "count" && op != "moves" && !(op == "pack" && !output.empty())) {
+        std::cerr << "usage: bitboard [perft DEPTH|count|moves|pack OUTPUT|pgn [fen|hash]] [-f FILE] [-t THREADS], bitboard unpack -f FILE, without arguments the interactive CLI" << std::endl;
+        return 2;
+    }
+
+    std::ifstream file;
+    if (!path.empty()) {
+        file.open(path);
+        if (!file) {
+            std::cerr << "Error: cannot read " << path << std::endl;
+            return 2;
+        }
+    }
+    std::istream &in = path.empty() ? std::cin : file;
+    std::ios::sync_with_stdio(false);
+    if (op == "pack") return packLines(in, output);
+
+    constexpr size_t CHUNK = 4096, JOB = 64; // lines per chunk, lines per pool job
+    std::vector<std::string> lines(CHUNK), results(CHUNK);
+    std::string out;
+    WorkStealingPool pool(threads);
+    uint64_t positions = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    while (true) {
+        size_t count = 0;
+        while (count < CHUNK && getline(in, lines[count])) {
+            if (!lineFEN(lines[count]).empty() && lines[count][0] != '#') count++;
+        }
+        if (!count) break;
+
+        pool.run((count + JOB - 1) / JOB, [&](size_t job) {
+            for (size_t j = job * JOB; j < std::min(count, (job + 1) * JOB); j++) results[j] = batchLine(lines[j], op, depth);
+        });
+        out.clear();
+        for (size_t j = 0; j < count; j++) out += results[j];
+        std::cout.write(out.data(), out.size());
+        positions += count;
+    }
+    std::cout.flush();
+    auto end_time = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end_time - start_time).count();
+    std::cerr << positions << " positions in " << seconds << " s, " << (seconds > 0 ? positions / seconds : 0.0)
+              << " positions/s (" << pool.size() << " threads)" << std::endl;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) return batch(argc, argv);
 
     cli();
 
     return 0;
-}
\ No newline at end of file
+}
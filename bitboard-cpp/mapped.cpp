@@ -0,0 +1,33 @@
+#include "mapped.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat info;
+    if (fstat(fd, &info) == 0) {
+        length = info.st_size;
+        if (!length) opened = true;
+        else {
+            void *map = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                bytes = static_cast<const char*>(map);
+                opened = true;
+            }
+        }
+    }
+    close(fd);
+    if (!opened) length = 0;
+}
+
+MappedFile::~MappedFile() {
+    if (bytes) munmap(const_cast<char*>(bytes), length);
+}
+
+void MappedFile::sequential() const {
+    if (bytes) madvise(const_cast<char*>(bytes), length, MADV_SEQUENTIAL);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+// a whole file mapped read-only, for the readers that work on it in place. An empty file is ok with size 0
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile &operator=(const MappedFile&) = delete;
+
+    bool ok() const { return opened; }
+    const char *data() const { return bytes; }
+    size_t size() const { return length; }
+    std::string_view view() const { return {bytes, length}; }
+
+    void sequential() const; // hint that the file is read front to back
+
+private:
+    bool opened = false;
+    const char *bytes = nullptr;
+    size_t length = 0;
+};
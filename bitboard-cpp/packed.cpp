@@ -0,0 +1,109 @@
+#include "packed.h"
+#include "bitboard.h"
+
+#include <cstring>
+#include <cassert>
+
+bool PackedBoard::pack(const Board &board, PackedBoard &out, FenClocks clocks) {
+    Squares occ = board.w.occupied() | board.b.occupied();
+    if (_popcnt64(occ) > 32) return false;
+
+    out = {};
+    out.occupied = occ;
+    int i = 0;
+    for (Squares temp = occ; temp; temp = _blsr_u64(temp), i++) out.codes[i / 2] |= board.pieceOn(_tzcnt_u64(temp)) << (i % 2 * 4);
+    GameState state = board.state;
+    out.state = state.stateToInt();
+    out.epFile = state.ep ? _tzcnt_u64(board.ep) % 8 : 0;
+    out.halfmove = clocks.halfmove;
+    out.fullmove = clocks.fullmove;
+    return true;
+}
+
+bool PackedBoard::unpack(Board &board, FenClocks *clocks) const {
+    int count = _popcnt64(occupied);
+    if (count > 32 || state > 63 || epFile > 7 || (!(state & 2) && epFile) || reserved[0] || reserved[1]) return false;
+    Squares pieces[16] {}; // by mailbox code
+    uint64_t hash = 0; // piece keys, added as the pieces are placed
+    int i = 0;
+    for (Squares temp = occupied; temp; temp = _blsr_u64(temp), i++) {
+        unsigned code = codes[i / 2] >> (i % 2 * 4) & 15;
+        unsigned piece = (code & 7) - 1;
+        uint64_t square = _tzcnt_u64(temp);
+        if (piece > PAWN) return false;
+        pieces[code] |= 1ULL << square;
+        hash ^= zobrist.piece[code < 8][piece][square];
+    }
+    for (; i < 32; i++) {
+        if (codes[i / 2] >> (i % 2 * 4) & 15) return false; // the nibbles after the last piece are zero
+    }
+
+    // the structure readFEN requires, so that status() and generate can run on the board
+    constexpr unsigned W = mailboxCode<KING, true> - KING, B = mailboxCode<KING, false> - KING;
+    Pieces white {pieces[W + KING], pieces[W + QUEEN], pieces[W + ROOK], pieces[W + BISHOP], pieces[W + KNIGHT], pieces[W + PAWN]};
+    Pieces black {pieces[B + KING], pieces[B + QUEEN], pieces[B + ROOK], pieces[B + BISHOP], pieces[B + KNIGHT], pieces[B + PAWN]};
+    if (_popcnt64(white.k) != 1 || _popcnt64(black.k) != 1) return false;
+    if ((white.p | black.p) & 0xff000000000000ffULL) return false;
+
+    bool isWhite = state & 1, ep = state & 2, wL = state & 4, wR = state & 8, bL = state & 16, bR = state & 32;
+    if ((wL || wR) && !(white.k & 0x10ULL)) return false;
+    if ((bL || bR) && !(black.k & 0x1000000000000000ULL)) return false;
+    if ((wL && !(white.r & wLrookStart)) || (wR && !(white.r & wRrookStart)) || (bL && !(black.r & bLrookStart)) || (bR && !(black.r & bRrookStart))) return false;
+
+    // the pawn that just pushed is there and the square it crossed, where e.p. captures to, is empty
+    Squares enp = 0;
+    if (ep) {
+        enp = 1ULL << ((isWhite ? 4 : 3) * 8 + epFile);
+        Squares behind = isWhite ? enp << 8 : enp >> 8;
+        if (!((isWhite ? black.p : white.p) & enp) || (behind & occupied)) return false;
+    }
+
+    GameState gameState {ep, wL, wR, bL, bR, isWhite};
+    hash ^= (isWhite ? zobrist.side : 0) ^ zobrist.castle[gameState.castleToInt()] ^ zobrist.ep[_tzcnt_u64(enp)];
+    Board unpacked {white, black, enp, gameState, hash};
+    if ((isWhite ? status<false, false>(unpacked) : status<true, false>(unpacked)).checkCount) return false; // as readFEN
+    board = unpacked;
+    assert(board.hash == board.computeHash());
+    board.fillMailbox();
+    if (clocks) *clocks = {halfmove, fullmove};
+    return true;
+}
+
+PackedWriter::PackedWriter(const std::string &path) : file(std::fopen(path.c_str(), "wb")) {
+    if (!file) return;
+    std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+    uint32_t header[2] {PACKED_VERSION, sizeof(PackedBoard)};
+    failed = std::fwrite(PACKED_MAGIC, sizeof(PACKED_MAGIC), 1, file) != 1 || std::fwrite(header, sizeof(header), 1, file) != 1;
+}
+
+PackedWriter::~PackedWriter() {
+    close();
+}
+
+bool PackedWriter::write(const Board &board, FenClocks clocks) {
+    PackedBoard record;
+    if (!file || !PackedBoard::pack(board, record, clocks)) return false;
+    failed = failed || std::fwrite(&record, sizeof(record), 1, file) != 1;
+    count += !failed;
+    return !failed;
+}
+
+bool PackedWriter::close() {
+    if (!file) return !failed;
+    failed = std::fclose(file) != 0 || failed;
+    file = nullptr;
+    return !failed;
+}
+
+PackedReader::PackedReader(const std::string &path) : file(path) {
+    const char *bytes = file.data();
+    size_t length = file.size();
+    if (length < PACKED_HEADER) return;
+    uint32_t header[2];
+    memcpy(header, bytes + sizeof(PACKED_MAGIC), sizeof(header));
+    if (memcmp(bytes, PACKED_MAGIC, sizeof(PACKED_MAGIC)) || header[0] != PACKED_VERSION || header[1] != sizeof(PackedBoard)
+        || (length - PACKED_HEADER) % sizeof(PackedBoard)) return;
+    file.sequential();
+    records = reinterpret_cast<const PackedBoard*>(bytes + PACKED_HEADER);
+    count = (length - PACKED_HEADER) / sizeof(PackedBoard);
+}
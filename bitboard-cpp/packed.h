@@ -0,0 +1,78 @@
+#pragma once
+
+#include "base.h"
+#include "fen.h"
+#include "mapped.h"
+
+#include <string>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+
+// fixed width binary position, 32 bytes against about 60 of FEN text. The occupied squares are one bitboard,
+// the pieces on them 4-bit mailbox codes in square order, two per byte with the lower square in the low
+// nibble. A position has at most 32 pieces, so 16 bytes hold every code
+struct PackedBoard {
+    Squares occupied;
+    uint8_t codes[16];
+    uint8_t state; // GameState::stateToInt()
+    uint8_t epFile; // file of the pawn that just pushed when the state has ep, 0 otherwise
+    uint16_t halfmove;
+    uint16_t fullmove;
+    uint8_t reserved[2]; // zero
+
+    // false when the board has more than 32 pieces
+    static bool pack(const Board &board, PackedBoard &out, FenClocks clocks = {});
+
+    // false unless the record is one pack writes of a board readFEN accepts: valid piece codes, one king per
+    // side, no pawn on the first or last rank, castling rights with their king and rook in place, an e.p. pawn
+    // with the square behind it empty, the side not to move out of check, and zero spare bits. board is only
+    // written on success
+    bool unpack(Board &board, FenClocks *clocks = nullptr) const;
+};
+
+static_assert(sizeof(PackedBoard) == 32);
+
+// a file of PackedBoards is a 16 byte header, PACKED_MAGIC then the version and the record size as uint32,
+// followed by the records
+constexpr char PACKED_MAGIC[8] {'B', 'B', 'P', 'A', 'C', 'K', 'E', 'D'};
+constexpr uint32_t PACKED_VERSION = 1;
+constexpr size_t PACKED_HEADER = 16;
+
+// appends PackedBoards to a file through a stdio buffer
+class PackedWriter {
+public:
+    explicit PackedWriter(const std::string &path);
+    ~PackedWriter();
+    PackedWriter(const PackedWriter&) = delete;
+    PackedWriter &operator=(const PackedWriter&) = delete;
+
+    bool ok() const { return file && !failed; }
+    size_t size() const { return count; } // records written, up to the first failed write
+
+    bool write(const Board &board, FenClocks clocks = {}); // false for a board pack rejects
+    bool close(); // flushes, false when a write failed
+
+private:
+    std::FILE *file;
+    bool failed = false;
+    size_t count = 0;
+};
+
+// maps a file of PackedBoards read-only. The records are read in place, so any number of threads can unpack
+// from one reader
+class PackedReader {
+public:
+    explicit PackedReader(const std::string &path);
+
+    bool ok() const { return records; }
+    size_t size() const { return count; }
+
+    const PackedBoard &operator[](size_t i) const { return records[i]; }
+    bool board(size_t i, Board &board, FenClocks *clocks = nullptr) const { return records[i].unpack(board, clocks); }
+
+private:
+    MappedFile file;
+    const PackedBoard *records = nullptr;
+    size_t count = 0;
+};
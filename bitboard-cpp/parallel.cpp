@@ -0,0 +1,97 @@
+#include "parallel.h"
+
+WorkStealingPool::WorkStealingPool(int threads) : queues(threads < 1 ? 1 : threads) {
+    for (size_t i = 0; i < queues.size(); i++) workers.emplace_back(&WorkStealingPool::worker, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto &t : workers) t.join();
+}
+
+void WorkStealingPool::run(size_t count, const std::function<void(size_t)> &job) {
+    if (count == 0) return;
+    current = &job;
+    remaining = count;
+    for (size_t i = 0; i < count; i++) { // round robin, so every worker starts with a share
+        Queue &q = queues[i % queues.size()];
+        std::lock_guard<std::mutex> guard(q.lock);
+        q.items.push_back(i);
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        generation++;
+    }
+    wake.notify_all();
+
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [this] { return remaining == 0; });
+}
+
+bool WorkStealingPool::pop(size_t id, size_t &index) {
+    Queue &q = queues[id];
+    std::lock_guard<std::mutex> guard(q.lock);
+    if (q.items.empty()) return false;
+    index = q.items.back();
+    q.items.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t id, size_t &index) {
+    for (size_t i = 1; i < queues.size(); i++) {
+        Queue &q = queues[(id + i) % queues.size()];
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.items.empty()) continue;
+        index = q.items.front();
+        q.items.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::worker(size_t id) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        size_t index;
+        while (pop(id, index) || steal(id, index)) {
+            (*current)(index);
+            if (--remaining == 0) {
+                std::lock_guard<std::mutex> guard(lock);
+                done.notify_all();
+            }
+        }
+    }
+}
+
+void collectSplit(int depth, Board &initial, std::vector<Board> &out) {
+    if (depth == 0) {
+        out.push_back(initial);
+        return;
+    }
+    forEachChild(initial, [&](Board &child) { collectSplit(depth-1, child, out); });
+}
+
+uint64_t parallelPerft(int depth, Board &initial, WorkStealingPool &pool, int splitDepth) {
+    if (splitDepth > depth - 1) splitDepth = depth - 1;
+    if (splitDepth < 1) return perft(depth, initial);
+
+    std::vector<Board> subtrees;
+    collectSplit(splitDepth, initial, subtrees);
+
+    std::vector<uint64_t> counts(subtrees.size());
+    pool.run(subtrees.size(), [&](size_t i) { counts[i] = perft(depth - splitDepth, subtrees[i]); });
+
+    uint64_t total = 0;
+    for (auto c : counts) total += c;
+    return total;
+}
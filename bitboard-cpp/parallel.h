@@ -0,0 +1,53 @@
+#pragma once
+
+#include "perft.h"
+
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+// fixed set of workers, each with its own deque of job indices. A worker pops from the back of its
+// own deque and, once that is empty, steals from the front of the others
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threads);
+    ~WorkStealingPool();
+
+    int size() const { return (int) queues.size(); }
+
+    // runs job(i) for every i in [0, count) and returns once all of them have finished
+    void run(size_t count, const std::function<void(size_t)> &job);
+
+private:
+    struct Queue {
+        std::mutex lock;
+        std::deque<size_t> items;
+    };
+
+    std::vector<Queue> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex lock;
+    std::condition_variable wake;
+    std::condition_variable done;
+    uint64_t generation = 0;
+    bool stopping = false;
+
+    const std::function<void(size_t)> *current = nullptr;
+    std::atomic<size_t> remaining {0};
+
+    bool pop(size_t id, size_t &index);
+    bool steal(size_t id, size_t &index);
+    void worker(size_t id);
+};
+
+void collectSplit(int depth, Board &initial, std::vector<Board> &out);
+
+// expands the tree splitDepth plies deep, then runs perft on every resulting subtree in the pool.
+// Subtree counts are stored per index, so the total does not depend on scheduling
+uint64_t parallelPerft(int depth, Board &initial, WorkStealingPool &pool, int splitDepth);
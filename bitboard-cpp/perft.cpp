@@ -0,0 +1,376 @@
+#include "perft.h"
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include <functional>
+
+BufferFunctionPtr bufferFunctionArray[64] = {
+    generateMoves<0, 0, 0, 0, 0, 0>,
+    generateMoves<1, 0, 0, 0, 0, 0>,
+    generateMoves<0, 1, 0, 0, 0, 0>,
+    generateMoves<1, 1, 0, 0, 0, 0>,
+    generateMoves<0, 0, 1, 0, 0, 0>,
+    generateMoves<1, 0, 1, 0, 0, 0>,
+    generateMoves<0, 1, 1, 0, 0, 0>,
+    generateMoves<1, 1, 1, 0, 0, 0>,
+    generateMoves<0, 0, 0, 1, 0, 0>,
+    generateMoves<1, 0, 0, 1, 0, 0>,
+    generateMoves<0, 1, 0, 1, 0, 0>,
+    generateMoves<1, 1, 0, 1, 0, 0>,
+    generateMoves<0, 0, 1, 1, 0, 0>,
+    generateMoves<1, 0, 1, 1, 0, 0>,
+    generateMoves<0, 1, 1, 1, 0, 0>,
+    generateMoves<1, 1, 1, 1, 0, 0>,
+    generateMoves<0, 0, 0, 0, 1, 0>,
+    generateMoves<1, 0, 0, 0, 1, 0>,
+    generateMoves<0, 1, 0, 0, 1, 0>,
+    generateMoves<1, 1, 0, 0, 1, 0>,
+    generateMoves<0, 0, 1, 0, 1, 0>,
+    generateMoves<1, 0, 1, 0, 1, 0>,
+    generateMoves<0, 1, 1, 0, 1, 0>,
+    generateMoves<1, 1, 1, 0, 1, 0>,
+    generateMoves<0, 0, 0, 1, 1, 0>,
+    generateMoves<1, 0, 0, 1, 1, 0>,
+    generateMoves<0, 1, 0, 1, 1, 0>,
+    generateMoves<1, 1, 0, 1, 1, 0>,
+    generateMoves<0, 0, 1, 1, 1, 0>,
+    generateMoves<1, 0, 1, 1, 1, 0>,
+    generateMoves<0, 1, 1, 1, 1, 0>,
+    generateMoves<1, 1, 1, 1, 1, 0>,
+    generateMoves<0, 0, 0, 0, 0, 1>,
+    generateMoves<1, 0, 0, 0, 0, 1>,
+    generateMoves<0, 1, 0, 0, 0, 1>,
+    generateMoves<1, 1, 0, 0, 0, 1>,
+    generateMoves<0, 0, 1, 0, 0, 1>,
+    generateMoves<1, 0, 1, 0, 0, 1>,
+    generateMoves<0, 1, 1, 0, 0, 1>,
+    generateMoves<1, 1, 1, 0, 0, 1>,
+    generateMoves<0, 0, 0, 1, 0, 1>,
+    generateMoves<1, 0, 0, 1, 0, 1>,
+    generateMoves<0, 1, 0, 1, 0, 1>,
+    generateMoves<1, 1, 0, 1, 0, 1>,
+    generateMoves<0, 0, 1, 1, 0, 1>,
+    generateMoves<1, 0, 1, 1, 0, 1>,
+    generateMoves<0, 1, 1, 1, 0, 1>,
+    generateMoves<1, 1, 1, 1, 0, 1>,
+    generateMoves<0, 0, 0, 0, 1, 1>,
+    generateMoves<1, 0, 0, 0, 1, 1>,
+    generateMoves<0, 1, 0, 0, 1, 1>,
+    generateMoves<1, 1, 0, 0, 1, 1>,
+    generateMoves<0, 0, 1, 0, 1, 1>,
+    generateMoves<1, 0, 1, 0, 1, 1>,
+    generateMoves<0, 1, 1, 0, 1, 1>,
+    generateMoves<1, 1, 1, 0, 1, 1>,
+    generateMoves<0, 0, 0, 1, 1, 1>,
+    generateMoves<1, 0, 0, 1, 1, 1>,
+    generateMoves<0, 1, 0, 1, 1, 1>,
+    generateMoves<1, 1, 0, 1, 1, 1>,
+    generateMoves<0, 0, 1, 1, 1, 1>,
+    generateMoves<1, 0, 1, 1, 1, 1>,
+    generateMoves<0, 1, 1, 1, 1, 1>,
+    generateMoves<1, 1, 1, 1, 1, 1>,
+};
+
+std::vector<Board> generateMoves(Board &board) {
+    std::vector<Board> children;
+    forEachChild(board, [&](Board &child) { children.push_back(child); });
+    return children;
+}
+
+int generateMoveList(Board &board, Move *out) {
+    int count = 0;
+    forEachMove(board, [&](Move move) { out[count++] = move; });
+    return count;
+}
+
+int countLegal(Board &board) {
+    return withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        return countMoves<isWhite, ep, wL, wR, bL, bR>(board, status<isWhite, ep>(board));
+    });
+}
+
+bool pseudoLegal(const Board &board, Move move) {
+    return board.state.isWhite ? pseudoLegal<true>(board, move) : pseudoLegal<false>(board, move);
+}
+
+bool isLegal(Board &board, Move move) {
+    if (board.state.isWhite) {
+        if (!pseudoLegal<true>(board, move)) return false;
+        return isLegal<true>(board, board.state.ep ? status<true, true>(board) : status<true, false>(board), move);
+    }
+    if (!pseudoLegal<false>(board, move)) return false;
+    return isLegal<false>(board, board.state.ep ? status<false, true>(board) : status<false, false>(board), move);
+}
+
+CountFunctionPtr countFunctionArray[64] = {
+    countMoves<0, 0, 0, 0, 0, 0>,
+    countMoves<1, 0, 0, 0, 0, 0>,
+    countMoves<0, 1, 0, 0, 0, 0>,
+    countMoves<1, 1, 0, 0, 0, 0>,
+    countMoves<0, 0, 1, 0, 0, 0>,
+    countMoves<1, 0, 1, 0, 0, 0>,
+    countMoves<0, 1, 1, 0, 0, 0>,
+    countMoves<1, 1, 1, 0, 0, 0>,
+    countMoves<0, 0, 0, 1, 0, 0>,
+    countMoves<1, 0, 0, 1, 0, 0>,
+    countMoves<0, 1, 0, 1, 0, 0>,
+    countMoves<1, 1, 0, 1, 0, 0>,
+    countMoves<0, 0, 1, 1, 0, 0>,
+    countMoves<1, 0, 1, 1, 0, 0>,
+    countMoves<0, 1, 1, 1, 0, 0>,
+    countMoves<1, 1, 1, 1, 0, 0>,
+    countMoves<0, 0, 0, 0, 1, 0>,
+    countMoves<1, 0, 0, 0, 1, 0>,
+    countMoves<0, 1, 0, 0, 1, 0>,
+    countMoves<1, 1, 0, 0, 1, 0>,
+    countMoves<0, 0, 1, 0, 1, 0>,
+    countMoves<1, 0, 1, 0, 1, 0>,
+    countMoves<0, 1, 1, 0, 1, 0>,
+    countMoves<1, 1, 1, 0, 1, 0>,
+    countMoves<0, 0, 0, 1, 1, 0>,
+    countMoves<1, 0, 0, 1, 1, 0>,
+    countMoves<0, 1, 0, 1, 1, 0>,
+    countMoves<1, 1, 0, 1, 1, 0>,
+    countMoves<0, 0, 1, 1, 1, 0>,
+    countMoves<1, 0, 1, 1, 1, 0>,
+    countMoves<0, 1, 1, 1, 1, 0>,
+    countMoves<1, 1, 1, 1, 1, 0>,
+    countMoves<0, 0, 0, 0, 0, 1>,
+    countMoves<1, 0, 0, 0, 0, 1>,
+    countMoves<0, 1, 0, 0, 0, 1>,
+    countMoves<1, 1, 0, 0, 0, 1>,
+    countMoves<0, 0, 1, 0, 0, 1>,
+    countMoves<1, 0, 1, 0, 0, 1>,
+    countMoves<0, 1, 1, 0, 0, 1>,
+    countMoves<1, 1, 1, 0, 0, 1>,
+    countMoves<0, 0, 0, 1, 0, 1>,
+    countMoves<1, 0, 0, 1, 0, 1>,
+    countMoves<0, 1, 0, 1, 0, 1>,
+    countMoves<1, 1, 0, 1, 0, 1>,
+    countMoves<0, 0, 1, 1, 0, 1>,
+    countMoves<1, 0, 1, 1, 0, 1>,
+    countMoves<0, 1, 1, 1, 0, 1>,
+    countMoves<1, 1, 1, 1, 0, 1>,
+    countMoves<0, 0, 0, 0, 1, 1>,
+    countMoves<1, 0, 0, 0, 1, 1>,
+    countMoves<0, 1, 0, 0, 1, 1>,
+    countMoves<1, 1, 0, 0, 1, 1>,
+    countMoves<0, 0, 1, 0, 1, 1>,
+    countMoves<1, 0, 1, 0, 1, 1>,
+    countMoves<0, 1, 1, 0, 1, 1>,
+    countMoves<1, 1, 1, 0, 1, 1>,
+    countMoves<0, 0, 0, 1, 1, 1>,
+    countMoves<1, 0, 0, 1, 1, 1>,
+    countMoves<0, 1, 0, 1, 1, 1>,
+    countMoves<1, 1, 0, 1, 1, 1>,
+    countMoves<0, 0, 1, 1, 1, 1>,
+    countMoves<1, 0, 1, 1, 1, 1>,
+    countMoves<0, 1, 1, 1, 1, 1>,
+    countMoves<1, 1, 1, 1, 1, 1>,
+};
+
+PerftTable perftTable;
+
+// stack holds MAX_MOVES boards per remaining ply, so the recursion never allocates. The last ply only
+// counts the legal moves, without building the leaf boards. Interior nodes are looked up in perftTable when it is enabled
+uint64_t perftDispatch(int depth, Board &initial, Board *stack) {
+    if (depth==1) return countFunctionArray[initial.state.stateToInt()](initial);
+
+    uint64_t counts = 0;
+    if (perftTable.enabled() && perftTable.probe(initial.hash, depth, counts)) return counts;
+
+    Board *moves = stack;
+    int count = bufferFunctionArray[initial.state.stateToInt()](initial, moves);
+
+    for (int i = 0; i < count; i++) {
+        assert(moves[i].hash == moves[i].computeHash()); // incremental hash, checked in debug builds
+        assert(moves[i].mailboxInSync());
+        counts += perftDispatch(depth-1, moves[i], stack + MAX_MOVES);
+    }
+
+    if (perftTable.enabled()) perftTable.store(initial.hash, depth, counts);
+    return counts;
+}
+
+uint64_t perftDispatch(int depth, Board &initial) {
+    if (depth < 1) return 1;
+    std::vector<Board> stack((depth - 1) * MAX_MOVES);
+    uint64_t counts = perftDispatch(depth, initial, stack.data());
+    perftTable.collect();
+    return counts;
+}
+
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+uint64_t perftState(int depth, Board &board);
+
+// generator output that recurses into every child as soon as it is reported. The child's GameState is
+// known from the transition, so it is passed on as template arguments and no node below the root
+// goes through the function tables
+template<bool isWhite, bool wL, bool wR, bool bL, bool bR>
+struct PerftVisitor {
+    int depth; // of the children
+    uint64_t nodes;
+
+    template<bool ep, bool cwL, bool cwR, bool cbL, bool cbR>
+    void descend(Board next) {
+        assert(next.hash == next.computeHash()); // incremental hash, checked in debug builds
+        assert(next.mailboxInSync());
+        nodes += perftState<!isWhite, ep, cwL, cwR, cbL, cbR>(depth, next);
+    }
+
+    // for rook moves and captures, which may drop castling rights: they are read back from the child
+    template<bool cwL, bool cwR, bool cbL, bool cbR>
+    void settle(Board next) {
+        if constexpr (cwL) { if (!next.state.wL) return settle<false, cwR, cbL, cbR>(next); }
+        if constexpr (cwR) { if (!next.state.wR) return settle<cwL, false, cbL, cbR>(next); }
+        if constexpr (cbL) { if (!next.state.bL) return settle<cwL, cwR, false, cbR>(next); }
+        if constexpr (cbR) { if (!next.state.bR) return settle<cwL, cwR, cbL, false>(next); }
+        descend<false, cwL, cwR, cbL, cbR>(next);
+    }
+
+    // same rights with the mover's own castling rights removed
+    template<bool ep>
+    void kingDescend(Board next) {
+        if constexpr (isWhite) descend<ep, false, false, bL, bR>(next);
+        else descend<ep, wL, wR, false, false>(next);
+    }
+
+    template<int piece, bool white>
+    void pieceMove(Board &board, Squares from, Squares to) {
+        if constexpr (piece == KING) kingDescend<false>(board.pieceMove<piece, white>(from | to));
+        else if constexpr (piece == ROOK) settle<wL, wR, bL, bR>(board.pieceMove<piece, white>(from | to));
+        else descend<false, wL, wR, bL, bR>(board.pieceMove<piece, white>(from | to));
+    }
+
+    template<int piece, bool white>
+    void pieceMoveCapture(Board &board, Squares from, Squares to) {
+        if constexpr (piece == KING && isWhite) settle<false, false, bL, bR>(board.pieceMoveCapture<piece, white>(from | to));
+        else if constexpr (piece == KING) settle<wL, wR, false, false>(board.pieceMoveCapture<piece, white>(from | to));
+        else settle<wL, wR, bL, bR>(board.pieceMoveCapture<piece, white>(from | to));
+    }
+
+    template<bool white>
+    void pawnPush(Board &board, Squares from, Squares to) { descend<true, wL, wR, bL, bR>(board.pawnPush<white>(to, from | to)); }
+
+    template<bool white>
+    void pawnEP(Board &board, Squares from, Squares to) { descend<false, wL, wR, bL, bR>(board.pawnEP<white>(board.ep, from | to)); }
+
+    template<bool white>
+    void pawnPromote(Board &board, Squares from, Squares to) {
+        descend<false, wL, wR, bL, bR>(board.pawnPromote<QUEEN, white>(from, to));
+        descend<false, wL, wR, bL, bR>(board.pawnPromote<ROOK, white>(from, to));
+        descend<false, wL, wR, bL, bR>(board.pawnPromote<BISHOP, white>(from, to));
+        descend<false, wL, wR, bL, bR>(board.pawnPromote<KNIGHT, white>(from, to));
+    }
+
+    template<bool white>
+    void pawnPromoteCapture(Board &board, Squares from, Squares to) {
+        settle<wL, wR, bL, bR>(board.pawnPromoteCapture<QUEEN, white>(from, to));
+        settle<wL, wR, bL, bR>(board.pawnPromoteCapture<ROOK, white>(from, to));
+        settle<wL, wR, bL, bR>(board.pawnPromoteCapture<BISHOP, white>(from, to));
+        settle<wL, wR, bL, bR>(board.pawnPromoteCapture<KNIGHT, white>(from, to));
+    }
+
+    template<bool white>
+    void castleL(Board &board) { kingDescend<false>(board.castleL<white>()); }
+
+    template<bool white>
+    void castleR(Board &board) { kingDescend<false>(board.castleR<white>()); }
+};
+
+template<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>
+uint64_t perftState(int depth, Board &board) {
+    if (depth == 1) return countMoves<isWhite, ep, wL, wR, bL, bR>(board);
+
+    uint64_t counts = 0;
+    if (perftTable.enabled() && perftTable.probe(board.hash, depth, counts)) return counts;
+
+    PerftVisitor<isWhite, wL, wR, bL, bR> visitor {depth - 1, 0};
+    generate<isWhite, ep, wL, wR, bL, bR>(board, visitor);
+
+    if (perftTable.enabled()) perftTable.store(board.hash, depth, visitor.nodes);
+    return visitor.nodes;
+}
+
+uint64_t perft(int depth, Board &initial) {
+    if (depth < 1) return 1;
+    // the only runtime dispatch on the GameState, at the root
+    uint64_t counts = withState(initial, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        return perftState<isWhite, ep, wL, wR, bL, bR>(depth, initial);
+    });
+    perftTable.collect();
+    return counts;
+}
+
+uint64_t divide(int depth, Board &initial, const std::function<void(Move, uint64_t)> &report) {
+    if (depth < 1) return 1;
+    uint64_t total = 0;
+    forEachMove(initial, [&](Move move) {
+        Board next = initial.makeMove(move);
+        uint64_t nodes = depth == 1 ? 1 : perft(depth - 1, next);
+        report(move, nodes);
+        total += nodes;
+    });
+    return total;
+}
+
+// drops the quiet moves of an ALL generation, counting them, and passes the rest on as children
+template<typename F>
+struct CaptureFilter : ChildSink<F> {
+    uint64_t dropped = 0;
+
+    template<int piece, bool isWhite>
+    void pieceMove(Board &, Squares, Squares) { dropped++; }
+
+    template<bool isWhite>
+    void pawnPush(Board &, Squares, Squares) { dropped++; }
+
+    template<bool isWhite>
+    void castleL(Board &) { dropped++; }
+
+    template<bool isWhite>
+    void castleR(Board &) { dropped++; }
+};
+
+template<bool staged>
+void captureTree(int plies, Board &board, QuiescenceCounts &counts) {
+    counts.nodes++;
+    if (plies == 0) return;
+
+    auto descend = [&](Board &child) { captureTree<staged>(plies - 1, child, counts); };
+    if constexpr (staged) {
+        forEachChild<CAPTURES>(board, descend);
+    } else {
+        CaptureFilter<decltype(descend)&> sink {{descend}};
+        generate(board, sink);
+        counts.dropped += sink.dropped;
+    }
+}
+
+// the stages of one node must add up to ALL, and EVASIONS must be ALL exactly when in check
+bool stagesAgree(Board &board) {
+    int all = 0, captures = 0, quiets = 0, evasions = 0;
+    forEachMove(board, [&](Move) { all++; });
+    forEachMove<CAPTURES>(board, [&](Move) { captures++; });
+    forEachMove<QUIETS>(board, [&](Move) { quiets++; });
+    forEachMove<EVASIONS>(board, [&](Move) { evasions++; });
+    bool inCheck = withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+        return status<isWhite, ep>(board).checkCount > 0;
+    });
+    return captures + quiets == all && evasions == (inCheck ? all : 0);
+}
+
+template<bool staged>
+void quiescenceTree(int depth, int plies, Board &board, QuiescenceCounts &counts) {
+    if (depth == 0) return captureTree<staged>(plies, board, counts);
+    if (!stagesAgree(board)) counts.errors++;
+    forEachChild(board, [&](Board &child) { quiescenceTree<staged>(depth - 1, plies, child, counts); });
+}
+
+QuiescenceCounts quiescence(int depth, int plies, Board &initial, bool staged) {
+    QuiescenceCounts counts {0, 0, 0};
+    if (staged) quiescenceTree<true>(depth, plies, initial, counts);
+    else quiescenceTree<false>(depth, plies, initial, counts);
+    return counts;
+}
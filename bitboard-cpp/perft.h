@@ -0,0 +1,48 @@
+#pragma once
+
+#include "bitboard.h"
+#include "hashtable.h"
+
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+// generator instantiations for every GameState, indexed by GameState::stateToInt()
+using BufferFunctionPtr = int(*)(Board&, Board*);
+using CountFunctionPtr = int(*)(Board&);
+
+extern BufferFunctionPtr bufferFunctionArray[64];
+extern CountFunctionPtr countFunctionArray[64];
+
+// runtime GameState entry points on the generator sinks, for callers outside the hot path
+std::vector<Board> generateMoves(Board &board);
+int generateMoveList(Board &board, Move *out); // out holds at least MAX_MOVES moves
+int countLegal(Board &board); // number of legal moves, without generating them
+
+// whether move is one of the moves generateMoveList writes, without generating them. pseudoLegal is the
+// prefilter that leaves out the safety of the king, every legal move passes it
+bool pseudoLegal(const Board &board, Move move);
+bool isLegal(Board &board, Move move);
+
+extern PerftTable perftTable; // disabled until resized
+
+// templated recursion, the GameState is a template argument below the root
+uint64_t perft(int depth, Board &initial);
+
+// perft of every legal move, reported as it is counted; returns the total
+uint64_t divide(int depth, Board &initial, const std::function<void(Move, uint64_t)> &report);
+
+struct QuiescenceCounts {
+    uint64_t nodes; // of the capture trees
+    uint64_t dropped; // quiet moves generated and thrown away, always 0 when staged
+    uint64_t errors; // nodes of the perft tree whose stages did not add up to ALL
+};
+
+// quiescence workload without evaluation: perft to depth, then below every leaf the full tree of capture
+// sequences (captures, e.p. and promotions) up to plies deep. staged generates only the CAPTURES stage,
+// otherwise ALL is generated and the quiet moves are dropped, as a consumer without stages would
+QuiescenceCounts quiescence(int depth, int plies, Board &initial, bool staged);
+
+// same count through the function tables at every node, kept to compare against
+uint64_t perftDispatch(int depth, Board &initial, Board *stack);
+uint64_t perftDispatch(int depth, Board &initial);
@@ -0,0 +1,224 @@
+#include "pgn.h"
+#include "perft.h"
+
+#include <cstring>
+
+namespace {
+
+const char PIECE_LETTERS[] = "KQRBN"; // indexed by piece
+const char START_FEN[] = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+int pieceOfLetter(char c) {
+    const char *letter = c ? strchr(PIECE_LETTERS, c) : nullptr;
+    return letter ? letter - PIECE_LETTERS : -1;
+}
+
+bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+// a token ends at a space or at the start of a comment or a variation
+bool tokenEnd(char c) { return isSpace(c) || c == '{' || c == '}' || c == '(' || c == ')' || c == ';'; }
+
+bool isResult(std::string_view token) { return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*"; }
+
+bool inCheck(Board &board) {
+    return withState(board, [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() { return status<isWhite, ep>(board).checkCount != 0; });
+}
+
+// the value of the tag at i, which is on its '[', and i moved past the tag. Escaped quotes are kept escaped,
+// no FEN contains one
+std::string_view readTag(std::string_view game, size_t &i, std::string_view &name) {
+    size_t start = ++i;
+    while (i < game.size() && !isSpace(game[i]) && game[i] != '"' && game[i] != ']') i++;
+    name = game.substr(start, i - start);
+    while (i < game.size() && game[i] != '"' && game[i] != ']') i++;
+    std::string_view value;
+    if (i < game.size() && game[i] == '"') {
+        start = ++i;
+        while (i < game.size() && game[i] != '"') i += game[i] == '\\' ? 2 : 1;
+        value = game.substr(start, std::min(i, game.size()) - start);
+    }
+    while (i < game.size() && game[i] != ']' && game[i] != '\n') i++;
+    if (i < game.size()) i++;
+    return value;
+}
+
+} // namespace
+
+std::vector<std::string_view> splitGames(std::string_view pgn) {
+    std::vector<std::string_view> games;
+    size_t start = 0;
+    bool moves = false, content = false; // movetext since start, anything but spaces since start
+    for (size_t i = 0; i < pgn.size();) {
+        const char *newline = static_cast<const char*>(memchr(pgn.data() + i, '\n', pgn.size() - i));
+        size_t end = newline ? newline - pgn.data() + 1 : pgn.size();
+        size_t first = i;
+        while (first < end && isSpace(pgn[first])) first++;
+        if (first < end) {
+            if (pgn[first] != '[') moves = true;
+            else if (moves) {
+                games.push_back(pgn.substr(start, i - start));
+                start = i;
+                moves = false;
+            }
+            content = true;
+        }
+        i = end;
+    }
+    if (content && start < pgn.size()) games.push_back(pgn.substr(start));
+    return games;
+}
+
+PgnError findSAN(Board &board, std::string_view san, Move &move) {
+    while (!san.empty() && (san.back() == '+' || san.back() == '#' || san.back() == '!' || san.back() == '?')) san.remove_suffix(1);
+
+    // castles, with letter O or digit 0
+    int castle = 0; // 1 kingside, 2 queenside
+    if (san == "O-O" || san == "0-0") castle = 1;
+    else if (san == "O-O-O" || san == "0-0-0") castle = 2;
+
+    int piece = PAWN, promotion = 0, target = -1, fromFile = -1, fromRank = -1;
+    if (!castle) {
+        size_t i = 0, end = san.size();
+        if (end && pieceOfLetter(san[0]) >= 0) piece = pieceOfLetter(san[i++]);
+        if (piece == PAWN && end && pieceOfLetter(san[end - 1]) > KING) {
+            promotion = pieceOfLetter(san[--end]);
+            if (end && san[end - 1] == '=') end--;
+        }
+        if (end < i + 2 || san[end - 2] < 'a' || san[end - 2] > 'h' || san[end - 1] < '1' || san[end - 1] > '8') return PGN_SAN;
+        target = (san[end - 1] - '1') * 8 + san[end - 2] - 'a';
+        for (end -= 2; i < end; i++) {
+            char c = san[i];
+            if (c >= 'a' && c <= 'h' && fromFile < 0) fromFile = c - 'a';
+            else if (c >= '1' && c <= '8' && fromRank < 0) fromRank = c - '1';
+            else if (c != 'x') return PGN_SAN;
+        }
+    }
+
+    Move moves[MAX_MOVES];
+    int count = generateMoveList(board, moves);
+    int matches = 0;
+    for (int i = 0; i < count; i++) {
+        Move m = moves[i];
+        if (castle) {
+            if (!m.isCastle() || (m.to() > m.from()) != (castle == 1)) continue;
+        } else if (m.isCastle() || m.to() != target || m.piece() != piece || m.promotion() != promotion
+                   || (fromFile >= 0 && m.from() % 8 != fromFile) || (fromRank >= 0 && m.from() / 8 != fromRank)) {
+            continue;
+        }
+        move = m;
+        matches++;
+    }
+    return matches == 1 ? PGN_OK : matches ? PGN_AMBIGUOUS : PGN_ILLEGAL;
+}
+
+std::string moveToSAN(Board &board, Move move) {
+    std::string san;
+    int from = move.from(), to = move.to();
+    if (move.isCastle()) {
+        san = to > from ? "O-O" : "O-O-O";
+    } else {
+        if (move.piece() != PAWN) {
+            san += PIECE_LETTERS[move.piece()];
+            Move moves[MAX_MOVES];
+            int count = generateMoveList(board, moves);
+            bool other = false, sameFile = false, sameRank = false;
+            for (int i = 0; i < count; i++) {
+                Move m = moves[i];
+                if (m.piece() != move.piece() || m.to() != to || m.from() == from || m.isCastle()) continue;
+                other = true;
+                sameFile = sameFile || m.from() % 8 == from % 8;
+                sameRank = sameRank || m.from() / 8 == from / 8;
+            }
+            if (other && (!sameFile || sameRank)) san += 'a' + from % 8;
+            if (other && sameFile) san += '1' + from / 8;
+        } else if (move.isCapture()) {
+            san += 'a' + from % 8;
+        }
+        if (move.isCapture()) san += 'x';
+        san += 'a' + to % 8;
+        san += '1' + to / 8;
+        if (move.promotion()) {
+            san += '=';
+            san += PIECE_LETTERS[move.promotion()];
+        }
+    }
+    Board child = board.makeMove(move);
+    if (inCheck(child)) san += countLegal(child) ? '+' : '#';
+    return san;
+}
+
+PgnStatus replayGame(std::string_view game, const std::function<void(const Board&, FenClocks)> &visit) {
+    Board board;
+    FenClocks clocks;
+    readFEN(START_FEN, board);
+    size_t i = 0;
+
+    // tag pairs, only FEN is used
+    while (true) {
+        while (i < game.size() && isSpace(game[i])) i++;
+        if (i == game.size() || game[i] != '[') break;
+        std::string_view name;
+        size_t start = i;
+        std::string_view value = readTag(game, i, name);
+        if (name == "FEN" && readFEN(value, board, &clocks).error != FEN_OK) return {PGN_FEN, start, 0};
+    }
+    visit(board, clocks);
+
+    uint32_t plies = 0;
+    int variations = 0; // depth of the variation being skipped
+    while (i < game.size()) {
+        char c = game[i];
+        if (isSpace(c) || c == '}') {
+            i++;
+        } else if (c == '{') {
+            const char *close = static_cast<const char*>(memchr(game.data() + i, '}', game.size() - i));
+            i = close ? close - game.data() + 1 : game.size();
+        } else if (c == ';' || c == '%') { // comment or escape to the end of the line
+            const char *newline = static_cast<const char*>(memchr(game.data() + i, '\n', game.size() - i));
+            i = newline ? newline - game.data() + 1 : game.size();
+        } else if (c == '(') {
+            variations++;
+            i++;
+        } else if (c == ')') {
+            variations -= variations > 0;
+            i++;
+        } else {
+            size_t start = i;
+            while (i < game.size() && !tokenEnd(game[i])) i++;
+            std::string_view token = game.substr(start, i - start);
+            if (variations || c == '$') continue;
+            if (isResult(token)) break;
+
+            // a move number, which may run into the move as in 12.e4
+            size_t digits = 0;
+            while (digits < token.size() && token[digits] >= '0' && token[digits] <= '9') digits++;
+            if (digits && digits < token.size() && token[digits] == '.') {
+                while (digits < token.size() && token[digits] == '.') digits++;
+                token.remove_prefix(digits);
+                start += digits;
+                if (token.empty()) continue;
+            }
+
+            Move move;
+            PgnError error = findSAN(board, token, move);
+            if (error != PGN_OK) return {error, start, plies};
+            clocks.halfmove = move.piece() == PAWN || move.isCapture() ? 0 : clocks.halfmove + 1;
+            clocks.fullmove += !board.state.isWhite;
+            board = board.makeMove(move);
+            plies++;
+            visit(board, clocks);
+        }
+    }
+    return {PGN_OK, i, plies};
+}
+
+const char *pgnErrorName(PgnError error) {
+    switch (error) {
+    case PGN_OK: return "ok";
+    case PGN_FEN: return "fen";
+    case PGN_SAN: return "san";
+    case PGN_ILLEGAL: return "illegal";
+    case PGN_AMBIGUOUS: return "ambiguous";
+    }
+    return "unknown";
+}
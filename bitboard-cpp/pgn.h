@@ -0,0 +1,46 @@
+#pragma once
+
+#include "base.h"
+#include "fen.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// why replayGame stopped, at PgnStatus::offset
+enum PgnError {
+    PGN_OK,
+    PGN_FEN, // a FEN tag readFEN rejects
+    PGN_SAN, // a movetext token that is not a move, a move number, a comment, a NAG or a result
+    PGN_ILLEGAL, // a SAN no legal move matches
+    PGN_AMBIGUOUS, // a SAN more than one legal move matches
+};
+
+struct PgnStatus {
+    PgnError error;
+    size_t offset; // in the game, of the token that failed or on success of the end of the game
+    uint32_t plies; // moves played before it stopped
+};
+
+// the games of a PGN file, each from its first tag to the end of its movetext. A game starts at a line
+// beginning with '[' after movetext; the views point into pgn
+std::vector<std::string_view> splitGames(std::string_view pgn);
+
+// the legal move of board san names, matched on the moves the generator yields without making any of them.
+// Check, mate and annotation suffixes are ignored, and so is a capture 'x' that is missing or in excess.
+// move is only written on PGN_OK
+PgnError findSAN(Board &board, std::string_view san, Move &move);
+
+// SAN of a legal move of board, with the file or rank of the piece when another one can reach the square,
+// and + or # when it checks or mates
+std::string moveToSAN(Board &board, Move move);
+
+// replays the movetext of one game from the position of its FEN tag, the initial position without one.
+// visit gets the position before the first move and after every move. Comments, variations, NAGs, move
+// numbers and the result are skipped
+PgnStatus replayGame(std::string_view game, const std::function<void(const Board&, FenClocks)> &visit);
+
+const char *pgnErrorName(PgnError error);
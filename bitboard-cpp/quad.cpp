@@ -0,0 +1,27 @@
+#include "quad.h"
+
+#include <cstdint>
+#include <utility>
+#include <cassert>
+
+uint64_t quadPerft(int depth, const QuadBoard &quad) {
+    QuadView board = quad.view();
+    uint64_t nodes = 0;
+    QuadSink sink {quad, [&](QuadBoard &child) { // outside visit, so every state shares the piece kernels
+        assert(child.hash == child.unpack().computeHash()); // checked in debug builds
+        nodes += quadPerft(depth - 1, child);
+    }};
+    auto visit = [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() -> uint64_t {
+        statusReport res = status<isWhite, ep>(board);
+        if (depth == 1) return countMoves<isWhite, ep, wL, wR, bL, bR>(board, res);
+
+        generate<isWhite, ep, wL, wR, bL, bR, ALL>(board, res, sink);
+        return nodes;
+    };
+    return dispatchState(quad.state, visit, std::make_index_sequence<64>());
+}
+
+uint64_t quadPerft(int depth, Board &initial) {
+    if (depth < 1) return 1;
+    return quadPerft(depth, QuadBoard::pack(initial));
+}
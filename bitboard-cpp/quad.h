@@ -0,0 +1,241 @@
+#pragma once
+
+#include "bitboard.h"
+
+#include <cstdint>
+
+// what status() and the generator read of a QuadBoard, decoded without the hash or a mailbox
+struct QuadView {
+    Pieces w; Pieces b; Squares ep; GameState state;
+};
+
+// compact alternative to Board: the pieces as four quad-bitboards, the state in one byte. The four bits of a
+// square are its code, bit 0 set for black and bits 1-3 the piece + 1, so an empty square is 0. A QuadBoard
+// is 48 bytes against the 120 of a Board, and has the same transitions, so the moves the generator finds on
+// its QuadView are played on it through QuadSink below. Reading one kind of piece costs a few ANDs of the
+// planes instead of a load
+struct QuadBoard {
+    Squares quad[4];
+    uint64_t hash; // same key as Board::hash
+    uint8_t state; // GameState::stateToInt()
+    uint8_t ep; // square of the pawn that just pushed, 64 when there is none
+
+    static constexpr uint8_t WHITE = 1, EP = 2, WL = 4, WR = 8, BL = 16, BR = 32;
+
+    template<int piece, bool isWhite>
+    static constexpr unsigned code = (piece + 1) << 1 | !isWhite;
+
+    template<int piece>
+    Squares type() const {
+        constexpr unsigned c = code<piece, true>;
+        return (c & 2 ? quad[1] : ~quad[1]) & (c & 4 ? quad[2] : ~quad[2]) & (c & 8 ? quad[3] : ~quad[3]);
+    }
+
+    template<bool isWhite>
+    Pieces side() const {
+        Squares colour = isWhite ? ~quad[0] : quad[0];
+        return {type<KING>() & colour, type<QUEEN>() & colour, type<ROOK>() & colour, type<BISHOP>() & colour, type<KNIGHT>() & colour, type<PAWN>() & colour};
+    }
+
+    Squares occupied() const { return quad[1] | quad[2] | quad[3]; }
+
+    static QuadBoard pack(const Board &board) {
+        QuadBoard res {{0, 0, 0, 0}, board.hash, 0, (uint8_t) _tzcnt_u64(board.ep)};
+        const Squares pieces[2][6] {{board.b.k, board.b.q, board.b.r, board.b.b, board.b.n, board.b.p}, {board.w.k, board.w.q, board.w.r, board.w.b, board.w.n, board.w.p}};
+        for (int white = 0; white < 2; white++) {
+            for (int piece = 0; piece < 6; piece++) {
+                unsigned c = (piece + 1) << 1 | !white;
+                for (int plane = 0; plane < 4; plane++) {
+                    if (c & (1 << plane)) res.quad[plane] |= pieces[white][piece];
+                }
+            }
+        }
+        GameState state = board.state;
+        res.state = state.stateToInt();
+        return res;
+    }
+
+    GameState gameState() const {
+        return {bool(state & EP), bool(state & WL), bool(state & WR), bool(state & BL), bool(state & BR), bool(state & WHITE)};
+    }
+
+    QuadView view() const { return {side<true>(), side<false>(), ep < 64 ? 1ULL << ep : 0, gameState()}; }
+
+    // the whole Board, with the hash and the mailbox, to check the transitions against
+    Board unpack() const {
+        Board res {side<true>(), side<false>(), ep < 64 ? 1ULL << ep : 0, gameState(), hash};
+        res.fillMailbox();
+        return res;
+    }
+
+    uint8_t castles() const { return state >> 2 & 15; } // GameState::castleToInt()
+
+    QuadBoard child(QuadBoard next, uint64_t pieceKeys) const {
+        next.hash = hash ^ pieceKeys ^ zobrist.side ^ zobrist.castle[castles()] ^ zobrist.castle[next.castles()] ^ zobrist.ep[ep] ^ zobrist.ep[next.ep];
+        return next;
+    }
+
+    // the castling rights lost by a move touching these squares, from the king or a rook leaving its square
+    // or a rook captured on its corner; the king squares only matter for king moves
+    template<int piece, bool isWhite>
+    uint8_t nextState(Squares move) const {
+        uint8_t res = (state ^ WHITE) & ~EP;
+        if constexpr (piece == KING) res &= isWhite ? ~(WL | WR) : ~(BL | BR);
+        if (move & wLrookStart) res &= ~WL;
+        if (move & wRrookStart) res &= ~WR;
+        if (move & bLrookStart) res &= ~BL;
+        if (move & bRrookStart) res &= ~BR;
+        return res;
+    }
+
+    template<unsigned c>
+    static void toggle(QuadBoard &board, Squares squares) {
+        if constexpr (bool(c & 1)) board.quad[0] ^= squares;
+        if constexpr (bool(c & 2)) board.quad[1] ^= squares;
+        if constexpr (bool(c & 4)) board.quad[2] ^= squares;
+        if constexpr (bool(c & 8)) board.quad[3] ^= squares;
+    }
+
+    static void remove(QuadBoard &board, Squares square) {
+        for (auto &plane : board.quad) plane &= ~square;
+    }
+
+    template<bool isWhite>
+    uint64_t captureKey(Squares square) const { // key of the enemy piece on square
+        uint64_t index = _tzcnt_u64(square);
+        unsigned c = (quad[1] >> index & 1) | (quad[2] >> index & 1) << 1 | (quad[3] >> index & 1) << 2;
+        return zobrist.piece[!isWhite][c - 1][index];
+    }
+
+    template<int piece, bool isWhite>
+    QuadBoard pieceMove(Squares move) const { // move contains the initial and final bits of the piece
+        QuadBoard next = *this;
+        toggle<code<piece, isWhite>>(next, move);
+        next.state = nextState<piece, isWhite>(move);
+        next.ep = 64;
+        return child(next, Board::moveKey<piece, isWhite>(move));
+    }
+
+    template<int piece, bool isWhite>
+    QuadBoard pieceMoveCapture(Squares move) const {
+        Squares square = move & occupied() & (isWhite ? quad[0] : ~quad[0]);
+        QuadBoard next = *this;
+        remove(next, square);
+        toggle<code<piece, isWhite>>(next, move);
+        next.state = nextState<piece, isWhite>(move);
+        next.ep = 64;
+        return child(next, Board::moveKey<piece, isWhite>(move) ^ captureKey<isWhite>(square));
+    }
+
+    template<bool isWhite>
+    QuadBoard pawnPush(Squares pawnSquare, Squares move) const {
+        QuadBoard next = *this;
+        toggle<code<PAWN, isWhite>>(next, move);
+        next.state = (state ^ WHITE) | EP;
+        next.ep = _tzcnt_u64(pawnSquare);
+        return child(next, Board::moveKey<PAWN, isWhite>(move));
+    }
+
+    template<bool isWhite>
+    QuadBoard pawnEP(Squares pawnSquare, Squares move) const {
+        QuadBoard next = *this;
+        toggle<code<PAWN, !isWhite>>(next, pawnSquare);
+        toggle<code<PAWN, isWhite>>(next, move);
+        next.state = (state ^ WHITE) & ~EP;
+        next.ep = 64;
+        return child(next, Board::moveKey<PAWN, isWhite>(move) ^ zobrist.piece[!isWhite][PAWN][_tzcnt_u64(pawnSquare)]);
+    }
+
+    template<int piece, bool isWhite>
+    QuadBoard pawnPromote(Squares pawnSquare, Squares move) const {
+        QuadBoard next = *this;
+        toggle<code<PAWN, isWhite>>(next, pawnSquare);
+        toggle<code<piece, isWhite>>(next, move);
+        next.state = (state ^ WHITE) & ~EP;
+        next.ep = 64;
+        return child(next, Board::promoteKey<piece, isWhite>(pawnSquare, move));
+    }
+
+    template<int piece, bool isWhite>
+    QuadBoard pawnPromoteCapture(Squares pawnSquare, Squares move) const {
+        QuadBoard next = *this;
+        remove(next, move);
+        toggle<code<PAWN, isWhite>>(next, pawnSquare);
+        toggle<code<piece, isWhite>>(next, move);
+        next.state = nextState<PAWN, isWhite>(move);
+        next.ep = 64;
+        return child(next, Board::promoteKey<piece, isWhite>(pawnSquare, move) ^ captureKey<isWhite>(move));
+    }
+
+    template<bool isWhite>
+    QuadBoard castleL() const {
+        constexpr Squares king = isWhite ? 0x0000000000000014ULL : 0x1400000000000000ULL;
+        constexpr Squares rook = isWhite ? 0x0000000000000009ULL : 0x0900000000000000ULL;
+        QuadBoard next = *this;
+        toggle<code<KING, isWhite>>(next, king);
+        toggle<code<ROOK, isWhite>>(next, rook);
+        next.state = nextState<KING, isWhite>(0);
+        next.ep = 64;
+        return child(next, Board::moveKey<KING, isWhite>(king) ^ Board::moveKey<ROOK, isWhite>(rook));
+    }
+
+    template<bool isWhite>
+    QuadBoard castleR() const {
+        constexpr Squares king = isWhite ? 0x0000000000000050ULL : 0x5000000000000000ULL;
+        constexpr Squares rook = isWhite ? 0x00000000000000a0ULL : 0xa000000000000000ULL;
+        QuadBoard next = *this;
+        toggle<code<KING, isWhite>>(next, king);
+        toggle<code<ROOK, isWhite>>(next, rook);
+        next.state = nextState<KING, isWhite>(0);
+        next.ep = 64;
+        return child(next, Board::moveKey<KING, isWhite>(king) ^ Board::moveKey<ROOK, isWhite>(rook));
+    }
+};
+
+// a generator sink that plays every move on the QuadBoard the generated QuadView was decoded from, and
+// calls f(QuadBoard &child)
+template<typename F>
+struct QuadSink {
+    const QuadBoard &parent;
+    F f;
+
+    template<int piece, bool isWhite>
+    void pieceMove(QuadView &, Squares from, Squares to) { emit(parent.pieceMove<piece, isWhite>(from | to)); }
+
+    template<int piece, bool isWhite>
+    void pieceMoveCapture(QuadView &, Squares from, Squares to) { emit(parent.pieceMoveCapture<piece, isWhite>(from | to)); }
+
+    template<bool isWhite>
+    void pawnPush(QuadView &, Squares from, Squares to) { emit(parent.pawnPush<isWhite>(to, from | to)); }
+
+    template<bool isWhite>
+    void pawnEP(QuadView &board, Squares from, Squares to) { emit(parent.pawnEP<isWhite>(board.ep, from | to)); }
+
+    template<bool isWhite>
+    void pawnPromote(QuadView &, Squares from, Squares to) {
+        emit(parent.pawnPromote<QUEEN, isWhite>(from, to));
+        emit(parent.pawnPromote<ROOK, isWhite>(from, to));
+        emit(parent.pawnPromote<BISHOP, isWhite>(from, to));
+        emit(parent.pawnPromote<KNIGHT, isWhite>(from, to));
+    }
+
+    template<bool isWhite>
+    void pawnPromoteCapture(QuadView &, Squares from, Squares to) {
+        emit(parent.pawnPromoteCapture<QUEEN, isWhite>(from, to));
+        emit(parent.pawnPromoteCapture<ROOK, isWhite>(from, to));
+        emit(parent.pawnPromoteCapture<BISHOP, isWhite>(from, to));
+        emit(parent.pawnPromoteCapture<KNIGHT, isWhite>(from, to));
+    }
+
+    template<bool isWhite>
+    void castleL(QuadView &) { emit(parent.castleL<isWhite>()); }
+
+    template<bool isWhite>
+    void castleR(QuadView &) { emit(parent.castleR<isWhite>()); }
+
+    void emit(QuadBoard child) { f(child); }
+};
+
+// perft on QuadBoards, with the same runtime dispatched walk as attackPerft(depth, board, SCRATCH). status()
+// and the generator read the QuadView of every node, no Board is built except to check the hash in debug builds
+uint64_t quadPerft(int depth, Board &initial);
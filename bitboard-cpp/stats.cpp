@@ -0,0 +1,78 @@
+#include "stats.h"
+
+#include <mutex>
+
+void Stats::add(const Stats &other) {
+    for (int i = 0; i < 64; i++) states[i] += other.states[i];
+    checks += other.checks;
+    doubleChecks += other.doubleChecks;
+    pinned += other.pinned;
+    epCandidates += other.epCandidates;
+    castleCandidates += other.castleCandidates;
+    for (int i = 0; i < 6; i++) moves[i] += other.moves[i];
+    for (int i = 0; i < PHASES; i++) {
+        cycles[i] += other.cycles[i];
+        calls[i] += other.calls[i];
+    }
+}
+
+#if defined(BOARD_STATS)
+
+namespace {
+std::mutex exitedLock;
+Stats exited; // of the threads that exited
+}
+
+ThreadStats::~ThreadStats() {
+    std::lock_guard<std::mutex> guard(exitedLock);
+    exited.add(*this);
+}
+
+Stats collectStats() {
+    std::lock_guard<std::mutex> guard(exitedLock);
+    Stats res = exited;
+    res.add(threadStats);
+    return res;
+}
+
+void clearStats() {
+    std::lock_guard<std::mutex> guard(exitedLock);
+    exited = Stats();
+    static_cast<Stats&>(threadStats) = Stats();
+}
+
+#else
+
+Stats collectStats() { return Stats(); }
+void clearStats() {}
+
+#endif
+
+namespace {
+template<size_t N>
+void dumpArray(std::ostream &out, const uint64_t (&values)[N]) {
+    out << '[';
+    for (size_t i = 0; i < N; i++) out << (i ? ", " : "") << values[i];
+    out << ']';
+}
+}
+
+void dumpStats(std::ostream &out) {
+#if defined(BOARD_STATS)
+    Stats stats = collectStats();
+    uint64_t nodes = 0;
+    for (uint64_t count : stats.states) nodes += count;
+
+    out << "{\"enabled\": true, \"nodes\": " << nodes << ", \"states\": ";
+    dumpArray(out, stats.states);
+    out << ", \"checks\": " << stats.checks << ", \"doubleChecks\": " << stats.doubleChecks
+        << ", \"pinned\": " << stats.pinned << ", \"epCandidates\": " << stats.epCandidates
+        << ", \"castleCandidates\": " << stats.castleCandidates << ", \"moves\": {";
+    const char *pieces[6] {"king", "queen", "rook", "bishop", "knight", "pawn"};
+    for (int i = 0; i < 6; i++) out << (i ? ", " : "") << '"' << pieces[i] << "\": " << stats.moves[i];
+    out << "}, \"cycles\": {\"status\": " << stats.cycles[PHASE_STATUS] << ", \"generate\": " << stats.cycles[PHASE_GENERATE]
+        << "}, \"calls\": {\"status\": " << stats.calls[PHASE_STATUS] << ", \"generate\": " << stats.calls[PHASE_GENERATE] << "}}" << std::endl;
+#else
+    out << "{\"enabled\": false}" << std::endl;
+#endif
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#if defined(BOARD_STATS)
+#include <x86intrin.h>
+#endif
+
+// instrumentation of the generator, compiled in with BOARD_STATS (cmake -DBITBOARD_STATS=ON). The hooks are
+// wrapped in STATS(), which expands to nothing in a normal build, so the generator code is the same as without
+// this file
+enum StatPhase { PHASE_STATUS, PHASE_GENERATE, PHASES };
+
+struct Stats {
+    uint64_t states[64] {}; // nodes by GameState::stateToInt(), a node is a call to status()
+    uint64_t checks = 0;
+    uint64_t doubleChecks = 0;
+    uint64_t pinned = 0; // pinned pieces of the side to move
+    uint64_t epCandidates = 0; // own pawns beside the pawn that just pushed, before pins and checks
+    uint64_t castleCandidates = 0; // castles with the right and the squares in between empty
+    uint64_t moves[6] {}; // moves reported by generate by moving piece, 4 per promotion, castles as KING
+    uint64_t cycles[PHASES] {}; // rdtsc ticks spent in the phase, without the phases nested in it
+    uint64_t calls[PHASES] {};
+
+    void add(const Stats &other);
+};
+
+// the counters of the threads that exited plus the ones of the calling thread, zero without BOARD_STATS
+Stats collectStats();
+void clearStats(); // of the exited threads and the calling one
+void dumpStats(std::ostream &out); // collectStats() as one JSON object, {"enabled": false} without BOARD_STATS
+
+#if defined(BOARD_STATS)
+
+// counters of one thread, added to the shared ones when the thread exits
+struct ThreadStats : Stats {
+    ~ThreadStats();
+};
+
+inline thread_local ThreadStats threadStats;
+
+// scoped rdtsc timer of a phase. The time of the timers nested in it (status() of the children reached from
+// a generate sink) is subtracted, so the phases add up to the instrumented time
+struct PhaseTimer {
+    static inline thread_local PhaseTimer *current = nullptr;
+
+    StatPhase phase;
+    PhaseTimer *outer;
+    uint64_t inner = 0;
+    uint64_t start;
+
+    explicit PhaseTimer(StatPhase phase) : phase(phase), outer(current), start(__rdtsc()) { current = this; }
+
+    ~PhaseTimer() {
+        uint64_t elapsed = __rdtsc() - start;
+        threadStats.cycles[phase] += elapsed - inner;
+        threadStats.calls[phase]++;
+        if (outer) outer->inner += elapsed;
+        current = outer;
+    }
+};
+
+#define STATS(...) __VA_ARGS__
+#else
+#define STATS(...)
+#endif
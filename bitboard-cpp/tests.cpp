@@ -0,0 +1,324 @@
+#include "corpus.h"
+#include "batch.h"
+#include "packed.h"
+#include "pgn.h"
+#include "mapped.h"
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <memory>
+#include <unistd.h>
+
+// correctness tests over the EPD corpus, one per ctest entry; bench times the same code.
+// tests perft|quiescence|status|batch|fen|packed|pgn|legal [-f FILE] [-d DEPTH] [-m MODE] [-H HASH_MB] [-q PLIES] [-t THREADS] [-S SPLIT]
+// perft checks every count of the file up to DEPTH with the walk of -m, with the hash table when HASH_MB is set.
+// -t runs the template walk through parallelPerft on THREADS workers sharing the table, split SPLIT plies
+// below the root (default 2).
+// quiescence checks that the two walks of -m agree on the capture trees PLIES deep below perft DEPTH.
+// status, batch, fen, packed, pgn and legal work on the nodes of the perft trees down to DEPTH: checkFill()
+// against check(), countBatch() against countMoves(), round trips through FEN, PackedBoard files and PGN games
+// with the malformed input each reader must reject, and isLegal() against the generator.
+// The exit code is 1 when a test fails
+
+// FENs readFEN must reject, with the field it must blame
+const std::pair<const char*, FenError> badFENs[] {
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBN w KQkq - 0 1", FEN_PLACEMENT},
+    {"rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FEN_PLACEMENT},
+    {"rnbqkbnr/pppppppp/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FEN_PLACEMENT},
+    {"rnbqkbnr/ppppxppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FEN_PLACEMENT},
+    {"rnbqqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", FEN_KINGS},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNP w KQkq - 0 1", FEN_PAWNS},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1", FEN_SIDE},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR", FEN_SIDE},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkk - 0 1", FEN_CASTLING},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQxq - 0 1", FEN_CASTLING},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e3 0 1", FEN_EP},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq i6 0 1", FEN_EP},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 70000 1", FEN_CLOCK},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 0", FEN_CLOCK},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0x 1", FEN_CLOCK},
+    {"R3k3/8/8/8/8/8/8/4K3 w - - 0 1", FEN_CHECK},
+    {"4k3/8/8/8/8/8/8/r3K3 b - - 0 1", FEN_CHECK},
+};
+
+// records unpack must reject: a FEN that packs, then one change to its record
+const std::pair<const char*, void(*)(PackedBoard&)> badRecords[] {
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.codes[0] = 0x90; }}, // no code on e1
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.codes[0] = 0x11; }}, // two white kings, no black one
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.codes[1] = 0x02; }}, // a code after the last piece
+    {"4k3/8/8/8/8/8/8/R3K3 w - - 0 1", [](PackedBoard &r) { r.codes[0] = 0x16; }}, // a white pawn on a1
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.state |= 64; }},
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.reserved[1] = 1; }},
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.epFile = 4; }}, // e.p. file without e.p.
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.state |= 4; }}, // queenside right without a rook
+    {"4k3/8/8/8/8/8/8/R2K4 w - - 0 1", [](PackedBoard &r) { r.state |= 4; }}, // queenside right, king not on e1
+    {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.state |= 2; r.epFile = 4; }}, // no pawn on e5
+    {"4k3/8/4n3/4p3/8/8/8/4K3 w - - 0 1", [](PackedBoard &r) { r.state |= 2; r.epFile = 4; }}, // e6 occupied
+    {"R3k3/8/8/8/8/8/8/4K3 b - - 0 1", [](PackedBoard &r) { r.state |= 1; }}, // black in check, white to move
+};
+
+// PGN games replayGame must stop on, with the error it must give
+const std::pair<const char*, PgnError> badPGNs[] {
+    {"1. e4 e5 2. Ke3 *", PGN_ILLEGAL},
+    {"1. e4 e5 2. e5 *", PGN_ILLEGAL},
+    {"1. e8=Q *", PGN_ILLEGAL},
+    {"1. a4 a5 2. h4 h5 3. Ra3 Ra6 4. Rh3 Rh6 5. Rd3 *", PGN_AMBIGUOUS},
+    {"1. e4 Zz9 *", PGN_SAN},
+    {"1. e4 e5 2. -- *", PGN_SAN},
+    {"[FEN \"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1\"]\n\n1. e4 *", PGN_FEN},
+};
+
+std::string tempPath(const char *extension) {
+    return (std::filesystem::temp_directory_path() / ("bitboard-tests-" + std::to_string(getpid()) + extension)).string();
+}
+
+// the last line of every test: ok or FAIL with what it checked, and the number of mismatches on stderr
+bool report(uint64_t mismatches, uint64_t count, const std::string &what) {
+    if (mismatches) std::cerr << "Error: " << mismatches << " mismatches in " << count << " " << what << std::endl;
+    std::cout << (mismatches ? "FAIL " : "ok ") << count << " " << what << std::endl;
+    return !mismatches;
+}
+
+bool perftTest(const std::vector<EpdEntry> &entries, const std::string &mode, int maxDepth, size_t hashMB, WorkStealingPool *pool, int splitDepth) {
+    uint64_t mismatches = 0, positions = 0;
+    for (auto &entry : entries) {
+        Board board = parseFEN(entry.fen);
+        bool checked = false;
+        for (auto [depth, expected] : entry.expected) {
+            if (depth > maxDepth) continue;
+            perftTable.resize(hashMB);
+            uint64_t nodes = runPerft(mode, depth, board, pool, splitDepth);
+            if (nodes != expected) {
+                std::cerr << "Error: " << entry.fen << " depth " << depth << ": " << nodes << ", expected " << expected << std::endl;
+                mismatches++;
+            }
+            checked = true;
+        }
+        positions += checked;
+    }
+    return report(mismatches, positions, "positions");
+}
+
+bool quiescenceTest(const std::vector<EpdEntry> &entries, const std::string &mode, int depth, int plies) {
+    uint64_t mismatches = 0;
+    for (auto &entry : entries) {
+        Board board = parseFEN(entry.fen);
+        QuiescenceCounts first = firstWalk(mode, depth, plies, board);
+        QuiescenceCounts second = secondWalk(mode, depth, plies, board);
+        if (first.nodes != second.nodes || first.errors || second.errors) {
+            std::cerr << "Error: " << entry.fen << ": " << first.nodes << " and " << second.nodes << " nodes, "
+                      << first.errors + second.errors << " nodes with stages not adding up to ALL" << std::endl;
+            mismatches++;
+        }
+    }
+    return report(mismatches, entries.size(), "positions");
+}
+
+bool statusTest(std::vector<Board> &nodes) {
+    uint64_t mismatches = 0;
+    for (auto &node : nodes) {
+        statusReport res = statusOf<0>(node);
+        mismatches += !sameStatus(res, statusOf<1>(node)) + !sameStatus(res, statusOf<2>(node));
+    }
+    return report(mismatches, nodes.size(), "nodes");
+}
+
+bool batchTest(std::vector<Board> &nodes) {
+    BoardBatch batch;
+    for (auto &node : nodes) batch.push(node);
+    std::vector<uint64_t> counts(nodes.size());
+    std::vector<Squares> seen(nodes.size());
+    countBatch(batch, counts.data(), seen.data());
+
+    uint64_t mismatches = 0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        withState(nodes[i], [&]<bool isWhite, bool ep, bool wL, bool wR, bool bL, bool bR>() {
+            statusReport res = status<isWhite, ep>(nodes[i]);
+            mismatches += counts[i] != (uint64_t) countMoves<isWhite, ep, wL, wR, bL, bR>(nodes[i], res) || seen[i] != res.enemySeen;
+        });
+    }
+    return report(mismatches, nodes.size(), "nodes");
+}
+
+bool fenTest(std::vector<Board> &nodes) {
+    uint64_t mismatches = 0;
+    char text[MAX_FEN], again[MAX_FEN];
+    for (size_t i = 0; i < nodes.size(); i++) {
+        FenClocks clocks = nodeClocks(i), parsedClocks;
+        Board parsed;
+        size_t length = writeFEN(nodes[i], text, clocks);
+        if (readFEN({text, length}, parsed, &parsedClocks).error != FEN_OK) {
+            mismatches++;
+            continue;
+        }
+        size_t againLength = writeFEN(parsed, again, parsedClocks);
+        mismatches += !sameBoard(nodes[i], parsed) || parsedClocks.halfmove != clocks.halfmove || parsedClocks.fullmove != clocks.fullmove
+            || againLength != length || memcmp(again, text, length);
+    }
+    for (auto &[fen, error] : badFENs) {
+        Board board;
+        FenStatus status = readFEN(fen, board);
+        if (status.error != error) {
+            std::cerr << "Error: " << fen << " gave " << fenErrorName(status.error) << ", expected " << fenErrorName(error) << std::endl;
+            mismatches++;
+        }
+    }
+    return report(mismatches, nodes.size(), "FENs");
+}
+
+// the nodes written to a PackedBoard file and read back through the mapping
+bool packedTest(std::vector<Board> &nodes) {
+    size_t n = nodes.size();
+    std::string path = tempPath(".packed");
+    {
+        PackedWriter writer(path);
+        for (size_t i = 0; i < n; i++) writer.write(nodes[i], nodeClocks(i));
+        if (!writer.close()) {
+            std::cerr << "Error: cannot write " << path << std::endl;
+            return false;
+        }
+    }
+    PackedReader reader(path);
+    std::filesystem::remove(path); // the mapping stays valid
+
+    uint64_t mismatches = reader.size() != n;
+    for (size_t i = 0; i < n && i < reader.size(); i++) {
+        Board unpacked;
+        FenClocks clocks = nodeClocks(i), unpackedClocks;
+        mismatches += !reader.board(i, unpacked, &unpackedClocks) || !sameBoard(nodes[i], unpacked)
+            || unpackedClocks.halfmove != clocks.halfmove || unpackedClocks.fullmove != clocks.fullmove;
+    }
+    for (auto &[fen, corrupt] : badRecords) {
+        Board board;
+        PackedBoard record;
+        bool packed = PackedBoard::pack(parseFEN(fen), record);
+        corrupt(record);
+        if (!packed || record.unpack(board)) {
+            std::cerr << "Error: a corrupt record of " << fen << " was unpacked" << std::endl;
+            mismatches++;
+        }
+    }
+    return report(mismatches, n, "positions");
+}
+
+// a random game from every node written to a PGN file, mapped, split and replayed to its last position
+bool pgnTest(std::vector<Board> &nodes) {
+    size_t n = nodes.size();
+    std::vector<Board> finals(n);
+    std::string pgn;
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    for (size_t i = 0; i < n; i++) pgn += randomGame(nodes[i], seed, finals[i]);
+
+    std::string path = tempPath(".pgn");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(pgn.data(), pgn.size());
+        if (!out.flush()) {
+            std::cerr << "Error: cannot write " << path << std::endl;
+            return false;
+        }
+    }
+    MappedFile file(path);
+    std::filesystem::remove(path); // the mapping stays valid
+
+    std::vector<std::string_view> games = splitGames(file.view());
+    uint64_t mismatches = games.size() != n, plies = 0;
+    for (size_t i = 0; i < n && i < games.size(); i++) {
+        Board replayed;
+        PgnStatus status = replayGame(games[i], [&](const Board &board, FenClocks) { replayed = board; });
+        mismatches += status.error != PGN_OK || !sameBoard(replayed, finals[i]);
+        plies += status.plies;
+    }
+    for (auto &[game, error] : badPGNs) {
+        PgnStatus status = replayGame(game, [](const Board&, FenClocks) {});
+        if (status.error != error) {
+            std::cerr << "Error: " << game << " gave " << pgnErrorName(status.error) << ", expected " << pgnErrorName(error) << std::endl;
+            mismatches++;
+        }
+    }
+    return report(mismatches, n, "games, " + std::to_string(plies) + " plies");
+}
+
+// isLegal() on every candidate against the generator, and pseudoLegal() on the legal ones
+bool legalTest(std::vector<Board> &nodes) {
+    std::vector<Candidate> candidates = moveCandidates(nodes);
+    uint64_t mismatches = 0, legalCount = 0;
+    for (auto &candidate : candidates) {
+        Board &board = nodes[candidate.node];
+        bool pseudo = pseudoLegal(board, candidate.move);
+        if (isLegal(board, candidate.move) != candidate.legal || (candidate.legal && !pseudo)) {
+            if (mismatches++ < 10) std::cerr << "Error: " << toFEN(board) << " move " << std::hex << candidate.move.data << std::dec
+                                            << (candidate.legal ? " legal" : " illegal") << ", pseudoLegal " << pseudo << std::endl;
+        }
+        legalCount += candidate.legal;
+    }
+    return report(mismatches, candidates.size(), "moves, " + std::to_string(legalCount) + " legal");
+}
+
+int main(int argc, char **argv) {
+    const char *usage = "usage: tests perft|quiescence|status|batch|fen|packed|pgn|legal [-f FILE] [-d DEPTH] [-m MODE] [-H HASH_MB] [-q PLIES] [-t THREADS] [-S SPLIT]";
+    if (argc < 2) {
+        std::cerr << usage << std::endl;
+        return 2;
+    }
+    std::string test = argv[1];
+    std::string path = "perft.epd";
+    std::string mode = "template";
+    int depth = 0; // every depth of the file for perft, 2 for quiescence, 3 for the others
+    int plies = 4;
+    size_t hashMB = 0;
+    int threads = 0; // 0 for the walks of -m on this thread
+    int splitDepth = 2;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-f" && hasValue) path = argv[++i];
+        else if (arg == "-d" && hasValue) depth = atoi(argv[++i]);
+        else if (arg == "-m" && hasValue) mode = argv[++i];
+        else if (arg == "-H" && hasValue) hashMB = atoi(argv[++i]);
+        else if (arg == "-q" && hasValue) plies = atoi(argv[++i]);
+        else if (arg == "-t" && hasValue) threads = atoi(argv[++i]);
+        else if (arg == "-S" && hasValue) splitDepth = atoi(argv[++i]);
+        else {
+            std::cerr << usage << std::endl;
+            return 2;
+        }
+    }
+    if (threads && mode != "template") {
+        std::cerr << "Error: -t only runs the template walk" << std::endl;
+        return 2;
+    }
+
+    std::vector<EpdEntry> entries = readEPD(path);
+    if (entries.empty()) {
+        std::cerr << "Error: no positions in " << path << std::endl;
+        return 2;
+    }
+
+    if (test == "perft") {
+        std::unique_ptr<WorkStealingPool> pool;
+        if (threads) pool = std::make_unique<WorkStealingPool>(threads);
+        return perftTest(entries, mode, depth ? depth : 100, hashMB, pool.get(), splitDepth) ? 0 : 1;
+    }
+    if (test == "quiescence") return quiescenceTest(entries, mode, depth ? depth : 2, plies) ? 0 : 1;
+
+    std::vector<Board> nodes = collectNodes(entries, depth ? depth : 3);
+    bool ok;
+    if (test == "status") ok = statusTest(nodes);
+    else if (test == "batch") ok = batchTest(nodes);
+    else if (test == "fen") ok = fenTest(nodes);
+    else if (test == "packed") ok = packedTest(nodes);
+    else if (test == "pgn") ok = pgnTest(nodes);
+    else if (test == "legal") ok = legalTest(nodes);
+    else {
+        std::cerr << usage << std::endl;
+        return 2;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// keys for the 64-bit position hash: pieces, side to move, castling rights and ep file
+struct ZobristKeys {
+    uint64_t piece[2][6][64]; // [isWhite][piece][square]
+    uint64_t side; // white to move
+    uint64_t castle[16]; // indexed by GameState::castleToInt()
+    uint64_t ep[65]; // indexed by the square of the pawn that just pushed, ep[64] is the empty square set
+};
+
+constexpr uint64_t splitmix64(uint64_t &seed) {
+    uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+constexpr ZobristKeys generateZobristKeys() {
+    ZobristKeys keys {};
+    uint64_t seed = 0x5eed5eed5eed5eedULL;
+    for (int color = 0; color < 2; color++)
+        for (int piece = 0; piece < 6; piece++)
+            for (int square = 0; square < 64; square++) keys.piece[color][piece][square] = splitmix64(seed);
+    keys.side = splitmix64(seed);
+    for (int i = 0; i < 16; i++) keys.castle[i] = splitmix64(seed);
+
+    uint64_t file[8] {};
+    for (int i = 0; i < 8; i++) file[i] = splitmix64(seed);
+    for (int square = 0; square < 64; square++) keys.ep[square] = file[square % 8];
+    keys.ep[64] = 0;
+    return keys;
+}
+
+inline constexpr ZobristKeys zobrist = generateZobristKeys();